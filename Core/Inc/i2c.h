@@ -35,6 +35,7 @@ extern "C" {
 extern I2C_HandleTypeDef hi2c1;
 
 /* USER CODE BEGIN Private defines */
+extern DMA_HandleTypeDef hdma_i2c1_tx;
 
 /* USER CODE END Private defines */
 
@@ -49,6 +49,24 @@
 
 /* Private variables ---------------------------------------------------------*/
 /* USER CODE BEGIN Variables */
+#if OLED_DOUBLE_BUFFER_EN
+/* Definitions for displayTask */
+osThreadId_t displayTaskHandle;
+const osThreadAttr_t displayTask_attributes = {
+  .name = "displayTask",
+  .stack_size = 128 * 4,
+  .priority = (osPriority_t) osPriorityAboveNormal,
+};
+#endif
+#if OLED_GOVERNOR_EN
+/* Definitions for updateTask */
+osThreadId_t updateTaskHandle;
+const osThreadAttr_t updateTask_attributes = {
+  .name = "updateTask",
+  .stack_size = 128 * 4,
+  .priority = (osPriority_t) osPriorityAboveNormal,
+};
+#endif
 
 /* USER CODE END Variables */
 /* Definitions for defaultTask */
@@ -120,6 +138,12 @@ void MX_FREERTOS_Init(void) {
 
   /* USER CODE BEGIN RTOS_THREADS */
   /* add threads, ... */
+#if OLED_DOUBLE_BUFFER_EN
+  displayTaskHandle = osThreadNew(oled_display_task, NULL, &displayTask_attributes);
+#endif
+#if OLED_GOVERNOR_EN
+  updateTaskHandle = osThreadNew(oled_update_task, NULL, &updateTask_attributes);
+#endif
   /* USER CODE END RTOS_THREADS */
 
   /* USER CODE BEGIN RTOS_EVENTS */
@@ -141,11 +165,21 @@ void StartDefaultTask(void *argument)
 	key_state_t key;
 	
 	printf("Hello word\r\n");
+#if OLED_FRAME_LOCK_EN
+	oled_frame_begin();//一帧画完前不会被其他任务交换或刷新
+#endif
 	  oled_show_char(0, 0, 'A', OLED_FONT_6X8);
     oled_show_string(10, 0, (uint8_t*)"123", OLED_FONT_6X8);
 	 oled_show_string(10, 16, (uint8_t*)"123", OLED_FONT_6X8);
 	 oled_show_string(10, 32, (uint8_t*)"123", OLED_FONT_6X8);
+#if OLED_DOUBLE_BUFFER_EN
+	oled_swap_buffers();//交给显示任务刷新屏幕
+#else
 	oled_update_all();//必须要更新屏幕
+#endif
+#if OLED_FRAME_LOCK_EN
+	oled_frame_end();
+#endif
 
   /* Infinite loop */
   for(;;)
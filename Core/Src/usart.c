@@ -22,6 +22,7 @@
 
 /* USER CODE BEGIN 0 */
 #include "stdio.h"
+#include "oled_console.h"
 /* USER CODE END 0 */
 
 UART_HandleTypeDef huart1;
@@ -116,6 +117,23 @@ void HAL_UART_MspDeInit(UART_HandleTypeDef* uartHandle)
 int fputc(int ch, FILE *f)
 {
     HAL_UART_Transmit(&huart1, (uint8_t *)&ch, 1, 0xFFFF);
+#if OLED_CONSOLE_FPUTC_EN
+#if OLED_FRAME_LOCK_EN
+    oled_frame_begin(); // 不与其他任务正在绘制的帧交错
+#endif
+    oled_console_putc((char)ch);
+    if (ch == '\n') // 每行结束时刷新屏幕
+    {
+#if OLED_DOUBLE_BUFFER_EN
+        oled_swap_buffers();
+#else
+        oled_flush();
+#endif
+    }
+#if OLED_FRAME_LOCK_EN
+    oled_frame_end();
+#endif
+#endif
     return ch;
 }
 /* USER CODE END 1 */
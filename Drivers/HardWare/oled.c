@@ -1,486 +0,0 @@
-#include "oled.h"
-#include "oled_font.h"
-
-#include "string.h"
-#include "stdarg.h"
-#include "stdio.h"
-
-static uint8_t oled_display_buffer[OLED_PAGES][OLED_LIST];
-
-/**
- * @breif   ʼOLED
- * @param   
- * @retval  
- */
-void oled_init(void)
-{
-    OLED_INIT_FUNS();
-    OLED_WRITE_COMMAND((uint8_t *)oled_init_cmd, sizeof(oled_init_cmd) / sizeof(oled_init_cmd[0]));
-    oled_clear_all();
-    oled_update_all();
-}
-
-/**
- * @breif   OLEDλ
- * @param   page:ҳ 0-7
- * @param   x: 0-OLED_LIST
- * @retval  
- */
-void oled_set_cursor(uint8_t page, uint8_t x)
-{
-    uint8_t cmd[3];
-    cmd[0] = oled_cursor_cmd[0] | page;
-    cmd[1] = oled_cursor_cmd[1] | ((x & 0xF0) >> 4);
-    cmd[2] = oled_cursor_cmd[2] | (x & 0x0F);
-    OLED_WRITE_COMMAND(cmd, 3);
-}
-
-/**
- * @breif  ȡOLED
- * @param   
- * @retval  
- */
-void oled_reverse_all(void)
-{
-    uint8_t i, j;
-    for (i = 0; i < OLED_PAGES; i++)
-    {
-        for (j = 0; j < OLED_LIST; j++)
-        {
-            oled_display_buffer[i][j] ^= 0xFF;
-        }
-    }
-}
-
-/**
- * @breif   ȡָ
- * @param   x: 0-OLED_LIST
- * @param   y: 0-OLED_HEIGHT
- * @param   width: 0-OLED_LIST
- * @param   height:߶ 0-OLED_HEIGHT
- * @retval  
- */
-void oled_reverse_area(uint8_t x, uint8_t y, uint8_t width, uint8_t height)
-{
-    uint8_t i, j;
-
-    for (i = y; i < y + height; i++) // ָҳ
-    {
-        for (j = x; j < x + width; j++) // ָ
-        {
-            if (i < OLED_HEIGHT && j < OLED_WIDTH) // Ļݲʾ
-            {
-                oled_display_buffer[i / OLED_PAGES][j] ^= ~(0x01 << (i % 8)); // Դָ
-            }
-        }
-    }
-}
-
-/**
- * @breif  OLED
- * @param   
- * @retval  
- */
-void oled_clear_all(void)
-{
-    uint8_t i, j;
-    for (i = 0; i < OLED_PAGES; i++)
-    {
-        for (j = 0; j < OLED_LIST; j++)
-        {
-            oled_display_buffer[i][j] = 0x00;
-        }
-    }
-}
-
-/**
- * @breif   ָ
- * @param   x: 0-OLED_LIST
- * @param   y: 0-OLED_HEIGHT
- * @param   width: 0-OLED_LIST
- * @param   height:߶ 0-OLED_HEIGHT
- * @retval  
- */
-void oled_clear_area(uint8_t x, uint8_t y, uint8_t width, uint8_t height)
-{
-    uint8_t i, j;
-
-    for (i = y; i < y + height; i++) // ָҳ
-    {
-        for (j = x; j < x + width; j++) // ָ
-        {
-            if (i < OLED_HEIGHT && j < OLED_WIDTH) // Ļݲʾ
-            {
-                oled_display_buffer[i / OLED_PAGES][j] &= ~(0x01 << (i % 8)); // Դָ
-            }
-        }
-    }
-}
-
-/**
- * @breif   OLEDʾ
- * @param   
- * @retval  
- */
-void oled_update_all(void)
-{
-    uint8_t i;
-    for (i = 0; i < OLED_PAGES; i++)
-    {
-        oled_set_cursor(i, 0);
-        OLED_WRITE_DATA(oled_display_buffer[i], OLED_LIST);
-    }
-}
-
-/**
- * @breif   ָ
- * @param   x: 0-OLED_LIST
- * @param   y: 0-OLED_HEIGHT
- * @param   width: 0-OLED_LIST
- * @param   height:߶ 0-OLED_HEIGHT
- * @retval  
- */
-void oled_update_area(uint8_t x, uint8_t y, uint8_t width, uint8_t height)
-{
-    uint8_t i;
-
-    for (i = y / OLED_PAGES; i < (y + height - 1) / OLED_PAGES + 1; i++) // ָҳ
-    {
-        if (i < OLED_HEIGHT && x < OLED_WIDTH) // Ļݲʾ
-        {
-            oled_set_cursor(i, x);
-            OLED_WRITE_DATA(&oled_display_buffer[i][x], width);
-        }
-    }
-}
-
-/**
- * @breif   ʾͼ
- * @param   x: 0-OLED_LIST
- * @param   y: 0-OLED_HEIGHT
- * @param   image:ͼ
- * @param   width: 0-OLED_LIST
- * @param   height:߶ 0-OLED_HEIGHT
- * @retval  
- */
-void oled_show_image(uint8_t x, uint8_t y, const uint8_t *image, uint8_t width, uint8_t height)
-{
-    uint8_t i, j;
-    uint8_t page, shift;
-
-    oled_clear_area(x, y, width, height);
-    for (i = 0; i < (height - 1) / OLED_PAGES + 1; i++)
-    {
-        for (j = 0; j < width; j++)
-        {
-            if (x + j < OLED_WIDTH)
-            {
-                page = y / OLED_PAGES;
-                shift = y % OLED_PAGES;
-
-                if (page + i < OLED_PAGES)
-                {
-                    oled_display_buffer[page + i][x + j] |= image[i * width + j] << (shift);
-                }
-
-                if (page + i + 1 < OLED_PAGES)
-                {
-                    oled_display_buffer[page + i + 1][x + j] |= image[i * width + j] >> (OLED_PAGES - shift);
-                }
-            }
-        }
-    }
-}
-
-/**
- * @breif   ʾַ
- * @param   x: 0-OLED_LIST
- * @param   y: 0-OLED_HEIGHT
- * @param   ch:ַ
- * @param   font_size:С
- * @retval  
- */
-void oled_show_char(uint8_t x, uint8_t y, uint8_t ch, uint8_t font_size)
-{
-    if (font_size == OLED_FONT_6X8) // Ϊ6أ8
-    {
-        /*ASCIIģOLED_F6x8ָ6*8ͼʽʾ*/
-        oled_show_image(x, y, oled_font_6x8[ch - ' '], font_size, 8);
-    }
-    else if (font_size == OLED_FONT_7X12) // Ϊ6أ12
-    {
-        /*ASCIIģOLED_F6x8ָ6*8ͼʽʾ*/
-        oled_show_image(x, y, oled_font_7x12[ch - ' '], font_size, 12);
-    }
-    else if (font_size == OLED_FONT_8X16) // Ϊ8أ16
-    {
-        /*ASCIIģOLED_F8x16ָ8*16ͼʽʾ*/
-        oled_show_image(x, y, oled_font_8x16[ch - ' '], font_size, 16);
-    }
-}
-
-/**
- * @breif   ʾַGBK
- * @param   x: 0-OLED_LIST
- * @param   y: 0-OLED_HEIGHT
- * @param   str:ַ
- * @param   font_size:С
- * @retval  
- */
-void oled_show_string(uint8_t x, uint8_t y, uint8_t *str, uint8_t font_size)
-{
-    uint8_t char_len = 0;
-    char temp_char[5];
-    uint16_t index;
-    uint8_t width;
-    uint8_t height;
-
-    while (*str != '\0')
-    {
-        if ((*str & 0x80) == 0x00)
-        {
-            char_len = 1;
-            temp_char[0] = *str++;
-            temp_char[1] = '\0';
-        }
-        else // λΪ1
-        {
-            char_len = 2;
-            temp_char[0] = *str++;
-            if (*str == '\0')
-                break;
-            temp_char[1] = *str++;
-            temp_char[2] = '\0';
-        }
-
-        if (char_len == 1) // ǵַֽ
-        {
-            oled_show_char(x, y, temp_char[0], font_size);
-            x += font_size;
-        }
-        else // ˫ַֽ
-        {
-            const OLED_Character_t *pchar = NULL;
-            if (font_size == OLED_FONT_7X12)
-            {
-                pchar = oled_Cfont_12x12;
-                width = 12;
-                height = 12;
-            }
-            else if (font_size == OLED_FONT_8X16)
-            {
-                pchar = oled_Cfont_16x16;
-                width = 16;
-                height = 16;
-            }
-            for (index = 0; strcmp((const char *)pchar[index].Index, "") != 0; index++)
-            {
-                if (strcmp((const char *)pchar[index].Index, temp_char) == 0)
-                {
-                    break;
-                }
-            }
-            oled_show_image(x, y, pchar[index].Data, width, height);
-            x += width;
-        }
-    }
-}
-
-/**
- * @breif  ɱʽַ
- * @param   x: 0-OLED_LIST
- * @param   y: 0-OLED_HEIGHT
- * @param   font_size:С
- * @param   fmt:ʽַ
- * @retval  
- */
-void oled_printf(uint8_t x, uint8_t y, uint8_t font_size, const char *fmt, ...)
-{
-    char str[64];
-    va_list args;
-    va_start(args, fmt);
-    vsnprintf(str, sizeof(str), fmt, args);
-    va_end(args);
-    oled_show_string(x, y, (uint8_t *)str, font_size);
-}
-
-/**
- * @breif   ָλûһ
- * @param   x: 0-OLED_LIST
- * @param   y: 0-OLED_HEIGHT
- * @retval  
- */
-void oled_draw_point(uint8_t x, uint8_t y)
-{
-    if (x < OLED_WIDTH && y < OLED_HEIGHT)
-    {
-        oled_display_buffer[y / OLED_PAGES][x] |= (0x01 << (y % 8));
-    }
-}
-
-/**
- * @breif   ָλûһ
- * @param   x: 0-OLED_LIST
- * @param   y: 0-OLED_HEIGHT
- * @param   width: 0-OLED_LIST
- * @param   height:߶ 0-OLED_HEIGHT
- * @param   fill:Ƿ 0- 1-
- */
-void oled_draw_rectangle(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t fill)
-{
-    uint8_t i, j;
-    if (fill)
-    {
-        for (i = x; i < x + width; i++)
-        {
-            for (j = y; j < y + height; j++)
-            {
-                oled_draw_point(i, j);
-            }
-        }
-    }
-    else
-    {
-        for (i = x; i < x + width; i++)
-        {
-            oled_draw_point(i, y);
-            oled_draw_point(i, y + height - 1);
-        }
-        for (i = y; i < y + height; i++)
-        {
-            oled_draw_point(x, i);
-            oled_draw_point(x + width - 1, i);
-        }
-    }
-}
-
-#if OLED_FONT_GBK_EN
-
-/**
- * @breif   ʾַ
- * @param   x: 0-OLED_LIST
- * @param   y: 0-OLED_HEIGHT
- * @param   str:ַ
- * @param   font_size:С
- * @retval  
- */
-void oled_show_font_string(uint8_t x, uint8_t y, const uint8_t *str, uint8_t font_size)
-{
-
-    const char *font_file = (font_size == OLED_FONT_7X12) ? GBK12_FONT_PATH
-                                                          : GBK16_FONT_PATH;
-
-    const uint8_t glyph_bytes = (font_size == OLED_FONT_7X12) ? 24U  /* 1212 ȣ24 ֽ */
-                                                              : 32U; /* 1616 ȣ32 ֽ */
-
-    const uint8_t glyph_width = (font_size == OLED_FONT_7X12) ? 12U  /* 1212 ȣ24 ֽ */
-                                                              : 16U; /* 1616 ȣ32 ֽ */
-
-    uint8_t font_buf[glyph_bytes];
-    uint8_t oled_buf[glyph_bytes];
-
-    FIL f;
-    uint8_t res;
-    res = f_open(&f, font_file, FA_READ);
-
-    while (*str)
-    {
-        uint8_t kind;
-        if (*str <= 0x7F)
-            kind = 0; /* ׼ ASCII */
-        if (*str >= 0x81)
-            kind = 1; /* GBK ֽ */
-
-        /* ---------- ASCII ---------- */
-        if (kind == 0)
-        {
-            oled_show_char(x, y, *str, font_size);
-            x += font_size;
-            ++str;
-        }
-        /* ---------- GBK1616 ---------- */
-        else if (kind == 1)
-        {
-            uint8_t high = *str++;
-            uint8_t low = *str++;
-
-            uint32_t idx = ((uint32_t)(high - 0x81U) * 190U) +
-                           ((uint32_t)(low - ((low < 0x7FU) ? 0x40U : 0x41U))); /* 0x8140 Ϊַʽ̶ */
-
-            uint32_t offset = idx * glyph_bytes;
-
-            if (res == FR_OK)
-            {
-                f_lseek(&f, offset);
-                if (f_read(&f, font_buf, glyph_bytes, &(UINT){0}) == FR_OK)
-                {
-                    for (uint8_t col = 0; col < glyph_width; ++col)
-                    {
-                        uint8_t byte0 = font_buf[col * 2];     // ֽ   0~7
-                        uint8_t byte1 = font_buf[col * 2 + 1]; // ֽ   8~11 4 λЧ
-
-                        // ϰ벿֣ 0~7  תλ˳OLED λ£
-                        uint8_t upper = 0;
-                        for (uint8_t bit = 0; bit < 8; ++bit)
-                            if (byte0 & (1U << bit))
-                                upper |= 1U << (7U - bit);
-                        oled_buf[col] = upper;
-
-                        // °벿֣ 8~11  ֻȡֽڵ 4 λٷת
-                        uint8_t lower = 0;
-                        for (uint8_t bit = 0; bit < 8; ++bit)
-                            if (byte1 & (1U << bit))
-                                lower |= 1U << (7U - bit);
-                        oled_buf[glyph_width + col] = lower;
-                    }
-                    oled_show_image(x, y, oled_buf, glyph_width, glyph_width);
-                }
-            }
-            x += glyph_width;
-        }
-    }
-    f_close(&f);
-}
-#endif
-
-/**
- * @breif   OLEDʾ
- * @param   set: 1-Աȶ 2-ĻתX 3-ĻתY 4-Ļɫ
- * @param   value:ֵ
- * @retval  
- */
-void oled_show_setting(uint8_t set, uint8_t value)
-{
-
-    uint8_t cmd[2];
-    if (set == 1) /* öԱȶ */
-    {
-        cmd[0] = 0x81;
-        cmd[1] = value;
-        OLED_WRITE_COMMAND(cmd, 2);
-    }
-    else if (set == 2) /* ĻתX */
-    {
-        if (value == 0)
-            cmd[0] = 0xA1;
-        else
-            cmd[0] = 0xA0;
-        OLED_WRITE_COMMAND(cmd, 1);
-    }
-    else if (set == 3) /* ĻתY */
-    {
-        if (value == 0)
-            cmd[0] = 0xC8;
-        else
-            cmd[0] = 0xC0;
-        OLED_WRITE_COMMAND(cmd, 1);
-    }
-    else if (set == 4) /* Ļɫ */
-    {
-        if (value == 0)
-            cmd[0] = 0xA6;
-        else
-            cmd[0] = 0xA7;
-        OLED_WRITE_COMMAND(cmd, 1);
-    }
-}
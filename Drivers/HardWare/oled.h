@@ -1,229 +0,0 @@
-#ifndef __OLED_H_
-#define __OLED_H_
-
-/* =========================== û =========================== */
-
-#include "gpio.h"                       /*ûͷļ*/
-#include "spi.h"                        /*ûͷļ*/
-static inline void OLED_INIT_FUNS(void) /* OLEDʼӿ */
-{
-    HAL_Delay(100);
-    HAL_GPIO_WritePin(GPIOB, GPIO_PIN_14, GPIO_PIN_RESET);
-    HAL_Delay(100);
-    HAL_GPIO_WritePin(GPIOB, GPIO_PIN_14, GPIO_PIN_SET);
-    HAL_Delay(100);
-}
-static inline void OLED_WRITE_DATA(uint8_t *data, uint16_t len) /* OLEDдݽӿ */
-{
-    HAL_GPIO_WritePin(GPIOA, GPIO_PIN_8, GPIO_PIN_SET);
-    HAL_GPIO_WritePin(GPIOC, GPIO_PIN_6, GPIO_PIN_RESET);
-    HAL_SPI_Transmit(&hspi2, data, len, 1000);
-    HAL_GPIO_WritePin(GPIOC, GPIO_PIN_6, GPIO_PIN_SET);
-}
-static inline void OLED_WRITE_COMMAND(uint8_t *command, uint16_t len) /* OLEDдӿ */
-{
-    HAL_GPIO_WritePin(GPIOA, GPIO_PIN_8, GPIO_PIN_RESET);
-    HAL_GPIO_WritePin(GPIOC, GPIO_PIN_6, GPIO_PIN_RESET);
-    HAL_SPI_Transmit(&hspi2, command, len, 1000);
-    HAL_GPIO_WritePin(GPIOC, GPIO_PIN_6, GPIO_PIN_SET);
-}
-// clang-format off
-#define OLED_PAGES              8   /* 8ҳ */
-#define OLED_LIST               128 /* 128 */
-
-#define OLED_WIDTH              128 /* 128 */
-#define OLED_HEIGHT             64  /* 64 */
-
-#define OLED_FONT_6X8           6   /* 6x8 */
-#define OLED_FONT_7X12          7   /* 7x12 */
-#define OLED_FONT_8X16          8   /* 8x16 */
-
-#define OLED_FONT_GBK_EN        0   /* 1-ʹGBKʾ 0-رGBKʾ */
-
-#if OLED_FONT_GBK_EN
-    #define GBK12_FONT_PATH         "0:/SYSTEM/FONT/GBK12.FON"  // GBK12·
-    #define GBK16_FONT_PATH         "0:/SYSTEM/FONT/GBK16.FON"  // GBK16·
-    #include "Middlewares/FATFS/ff.h"   // ļϵͳ 
-#endif
-
-static const uint8_t oled_init_cmd[] = {
-    0xAE, // ʾ/رգ0xAEرգ0xAF
-    0xD5, // ʾʱӷƵ/Ƶ
-    0x80, // 0x00~0xFF
-    0xA8, // ö·
-    0x3F, // 0x0E~0x3F
-    0xD3, // ʾƫ
-    0x00, // 0x00~0x7F
-    0x40, // ʾʼУ0x40~0x7F
-    0xA1, // ҷ0xA10xA0ҷ
-    0xC8, // ·0xC80xC0·
-    0xDA, // COMӲ
-    0x12, // 0x02~0x07
-    0x81, // öԱȶ
-    0x55, // 0x00~0xFF
-    0xD9, // Ԥ
-    0xF1, // 0x00~0xFF
-    0xDB, // VCOMHȡѡ񼶱
-    0x30, // 0x00~0x3F
-    0xA4, // ʾ/ر
-    0xA6, // /ɫʾ0xA60xA7ɫ
-    0x8D, // ó
-    0x14, // 0x10
-    0xAF, // ʾ
-};
-
-static const uint8_t oled_cursor_cmd[] = {
-    0xB0, // ҳַ
-    0x10, // ʾʼи4λ
-    0x00, // ʾʼе4λ
-};
-// clang-format on
-
-/* =========================== ⲿ =========================== */
-
-#include "stdint.h"
-
-/**
- * @breif   ʼOLED
- * @param   
- * @retval  
- */
-void oled_init(void);
-
-/**
- * @breif   OLEDλ
- * @param   page:ҳ 0-7
- * @param   x: 0-OLED_LIST
- * @retval  
- */
-void oled_set_cursor(uint8_t page, uint8_t x);
-
-/**
- * @breif  ȡOLED
- * @param   
- * @retval  
- */
-void oled_reverse_all(void);
-
-/**
- * @breif   ȡָ
- * @param   x: 0-OLED_LIST
- * @param   y: 0-OLED_HEIGHT
- * @param   width: 0-OLED_LIST
- * @param   height:߶ 0-OLED_HEIGHT
- * @retval  
- */
-void oled_reverse_area(uint8_t x, uint8_t y, uint8_t width, uint8_t height);
-
-/**
- * @breif  OLED
- * @param   
- * @retval  
- */
-void oled_clear_all(void);
-
-/**
- * @breif   OLEDʾ
- * @param   
- * @retval  
- */
-void oled_update_all(void);
-
-/**
- * @breif   ָ
- * @param   x: 0-OLED_LIST
- * @param   y: 0-OLED_HEIGHT
- * @param   width: 0-OLED_LIST
- * @param   height:߶ 0-OLED_HEIGHT
- * @retval  
- */
-void oled_clear_area(uint8_t x, uint8_t y, uint8_t width, uint8_t height);
-
-/**
- * @breif   ָ
- * @param   x: 0-OLED_LIST
- * @param   y: 0-OLED_HEIGHT
- * @param   width: 0-OLED_LIST
- * @param   height:߶ 0-OLED_HEIGHT
- * @retval  
- */
-void oled_update_area(uint8_t x, uint8_t y, uint8_t width, uint8_t height);
-
-/**
- * @breif   ʾͼ
- * @param   x: 0-OLED_LIST
- * @param   y: 0-OLED_HEIGHT
- * @param   image:ͼ
- * @param   width: 0-OLED_LIST
- * @param   height:߶ 0-OLED_HEIGHT
- * @retval  
- */
-void oled_show_image(uint8_t x, uint8_t y, const uint8_t *image, uint8_t width, uint8_t height);
-
-/**
- * @breif   ʾַ
- * @param   x: 0-OLED_LIST
- * @param   y: 0-OLED_HEIGHT
- * @param   ch:ַ
- * @param   font_size:С
- * @retval  
- */
-void oled_show_char(uint8_t x, uint8_t y, uint8_t ch, uint8_t font_size);
-
-/**
- * @breif   ʾַGBK
- * @param   x: 0-OLED_LIST
- * @param   y: 0-OLED_HEIGHT
- * @param   str:ַ
- * @param   font_size:С
- * @retval  
- */
-void oled_show_string(uint8_t x, uint8_t y, uint8_t *str, uint8_t font_size);
-
-/**
- * @breif  ɱʽַ
- * @param   x: 0-OLED_LIST
- * @param   y: 0-OLED_HEIGHT
- * @param   font_size:С
- * @param   fmt:ʽַ
- * @retval  
- */
-void oled_printf(uint8_t x, uint8_t y, uint8_t font_size, const char *fmt, ...);
-
-/**
- * @breif   ָλûһ
- * @param   x: 0-OLED_LIST
- * @param   y: 0-OLED_HEIGHT
- * @retval  
- */
-void oled_draw_point(uint8_t x, uint8_t y);
-
-/**
- * @breif   ָλûһ
- * @param   x: 0-OLED_LIST
- * @param   y: 0-OLED_HEIGHT
- * @param   width: 0-OLED_LIST
- * @param   height:߶ 0-OLED_HEIGHT
- * @param   fill:Ƿ 0- 1-
- */
-void oled_draw_rectangle(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t fill);
-
-/**
- * @breif   ʾַ
- * @param   x: 0-OLED_LIST
- * @param   y: 0-OLED_HEIGHT
- * @param   str:ַ
- * @param   font_size:С
- * @retval  
- */
-void oled_show_font_string(uint8_t x, uint8_t y, const uint8_t *str, uint8_t font_size);
-
-/**
- * @breif   OLEDʾ
- * @param   set: 1-Աȶ 2-ĻתX 3-ĻתY 4-Ļɫ
- * @param   value:ֵ
- * @retval  
- */
-void oled_show_setting(uint8_t set, uint8_t value);
-
-#endif
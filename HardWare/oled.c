@@ -1,209 +1,2261 @@
 #include "oled.h"
 #include "oled_font.h"
+#include "oled_format.h"
 
 #include "string.h"
 #include "stdarg.h"
 #include "stdio.h"
 
 
+static uint8_t oled_dirty_start[OLED_PAGES]; /* ÿҳʼ */
+static uint8_t oled_dirty_end[OLED_PAGES];   /* ÿҳ()ʼȱʾҳޱ仯 */
+static uint32_t oled_tx_bytes;               /* ۼƷ͵OLEDֽ(ֽ) */
+static uint8_t oled_scroll_page;             /* Դ0ҳӦGDDRAMҳʼΪ8 */
+static uint8_t oled_scroll_active;           /* 1-Ӳˮƽ/ԽǹУͣˢ */
+
+#if OLED_DOUBLE_BUFFER_EN
+static uint8_t oled_frame[2][OLED_PAGES][OLED_LIST];
+static uint8_t (*oled_display_buffer)[OLED_LIST] = oled_frame[0]; /* ̨壬ͼд */
+static uint8_t (*oled_front_buffer)[OLED_LIST] = oled_frame[1];   /* ǰ̨壬ˢºȡ */
+static uint8_t oled_front_dirty_start[OLED_PAGES];                /* ǰ̨͵ */
+static uint8_t oled_front_dirty_end[OLED_PAGES];
+static volatile uint8_t oled_front_busy;                          /* 1-ʾڷǰ̨ */
+static TaskHandle_t oled_display_task_handle;                     /* ʾ */
+static uint8_t oled_scroll_pending;                               /* ̨ѹδҳ */
+static uint8_t oled_front_scroll;                                 /* ǰ̨ѹδʼҳ */
+#else
 static uint8_t oled_display_buffer[OLED_PAGES][OLED_LIST];
+#define oled_front_buffer       oled_display_buffer /* ʱͼˢʹͬһԴ */
+#define oled_front_dirty_start  oled_dirty_start
+#define oled_front_dirty_end    oled_dirty_end
+#endif
+
+typedef struct
+{
+    uint8_t page_start; /* ʼҳ */
+    uint8_t page_end;   /* ҳҳʱΪ(0-OLED_LIST)Դһη */
+    uint8_t start;      /* ʼ */
+    uint8_t end;        /* () */
+} oled_span_t;
+
+static oled_context_t oled_ctx = {OLED_ROP_COPY, 0, 0, OLED_WIDTH, OLED_HEIGHT}; /* ǰͼ */
+static uint8_t (*oled_target)[OLED_LIST];         /* ͼĿ꣬NULLΪԴ */
+static uint16_t oled_target_height = OLED_HEIGHT; /* ͼĿ */
+
+/* դĴ׼ r = (d & k1) ^ (s & k2) ^ (d & s & k3)bit0-k1 bit1-k2 bit2-k3oled_rop_t */
+static const uint8_t oled_rop_anf[] = {
+    0x02, /* COPY   s */
+    0x07, /* OR     d ^ s ^ ds */
+    0x04, /* AND    ds */
+    0x03, /* XOR    d ^ s */
+    0x05, /* ANDNOT d ^ ds */
+};
+
+typedef struct
+{
+    uint16_t x;        /* һַ */
+    uint8_t y;         /*  */
+    uint8_t font_size; /* С */
+    uint8_t lead;      /* ֵһֽڣ0ʾ */
+} oled_text_sink_t;
+
+typedef struct
+{
+    int16_t x;    /* ǰ */
+    int16_t page; /* ǰҳΪ */
+    uint8_t mask; /* ǰҳڵλ */
+    uint8_t bits; /* ֽۻдλ */
+} oled_pen_t;
+
+typedef struct
+{
+    int32_t start_x; /* ʼ߷ cos*16384 */
+    int32_t start_y; /* ʼ߷ sin*16384 */
+    int32_t end_x;   /* ߷ */
+    int32_t end_y;
+    uint8_t wide;    /* 1-ԲĽǴ180 */
+} oled_arc_t;
+
+/* sin(0-90)*16384 */
+static const int16_t oled_sin_table[91] = {
+    0, 286, 572, 857, 1143, 1428, 1713, 1997, 2280, 2563,
+    2845, 3126, 3406, 3686, 3964, 4240, 4516, 4790, 5063, 5334,
+    5604, 5872, 6138, 6402, 6664, 6924, 7182, 7438, 7692, 7943,
+    8192, 8438, 8682, 8923, 9162, 9397, 9630, 9860, 10087, 10311,
+    10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+    12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+    14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+    15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+    16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+    16384,
+};
+
+#if OLED_FONT_GBK_EN
+typedef struct
+{
+    uint16_t code;    /* GBK */
+    uint8_t size;     /* С0ʾ */
+    uint32_t stamp;   /* һʹõʱ̣Сȱ滻 */
+    uint8_t data[32]; /* OLEDҳʽģ */
+} oled_glyph_t;
+
+static oled_glyph_t oled_glyph_cache[OLED_GLYPH_CACHE_NUM]; /* ģ */
+static uint32_t oled_glyph_clock;                           /* ʼʱ */
+static uint32_t oled_glyph_hit;                             /* д */
+static uint32_t oled_glyph_miss;                            /* δд */
+static FIL oled_font_file;                                  /* ִ򿪵ֿļ */
+static uint8_t oled_font_size;                              /* ѴֿС0ʾδ */
+#endif
+
+#define OLED_POLYGON_MAX        16  /* ε󶥵 */
+#define OLED_SPAN_OVERHEAD      10  /* ÿζ⿪(ַ++6)(ַ+)ֽ */
+#define OLED_ASYNC_WAIT_TICKS   pdMS_TO_TICKS(10) /* ȴʱÿʱ䣬ʱ¼ */
+#if OLED_TRANSPOSE_EN
+#define OLED_GATHER_SIZE        256 /* תûС֡4ڷ */
+#else
+#define OLED_GATHER_SIZE        64  /* ҳխεƴӻС */
+#endif
+
+static uint8_t oled_gather_buf[OLED_GATHER_SIZE]; /* ҳխηǰڴƴӣ첽ڼ䱣Ч */
+
+#if OLED_FRAME_LOCK_EN
+static SemaphoreHandle_t oled_frame_mutex;     /* ֡ͼһ֡ڼУǶ */
+static StaticSemaphore_t oled_frame_mutex_buf;
+#endif
+
+#if OLED_GOVERNOR_EN
+static TaskHandle_t oled_update_task_handle;   /* ϲˢ */
+static oled_update_stats_t oled_update_stats;  /* ϲˢͳ */
+static uint8_t oled_update_pending;            /* 1-δˢµ */
+static TickType_t oled_update_first;           /* ׸δˢʱ */
+static uint8_t oled_update_start[OLED_PAGES];  /* ˢµĸҳʼУɺϲˢ֡ */
+static uint8_t oled_update_end[OLED_PAGES];    /* ˢµĸҳ() */
+#endif
+
+#if OLED_ASYNC_EN
+static oled_span_t oled_async_span[OLED_PAGES]; /* 첽ˢµĸҳ */
+static uint8_t oled_async_cmd[6];               /* DMA壬ڼ뱣Ч */
+static uint8_t oled_async_count;                /*  */
+static uint8_t oled_async_step;                 /* Ĵż */
+static volatile uint8_t oled_async_busy;        /* 1-첽ˢ½ */
+static TaskHandle_t oled_async_notify;          /* ɺ֪ͨ */
+static SemaphoreHandle_t oled_async_idle;       /* 첽ˢ½ʱͷţȴߵڴ */
+static StaticSemaphore_t oled_async_idle_buf;
+static volatile uint8_t oled_async_retry;       /* ʱ׸δ͵Σoled_async_countʾ */
+#endif
+
+#if OLED_I2C_EN
+/**
+ * @breif   I2Cϵȴ
+ * @param   
+ * @retval  
+ */
+static void oled_i2c_init(void)
+{
+    HAL_Delay(100);
+}
+
+/**
+ * @breif   I2C
+ * @param   dc:0- 1-Դ
+ * @param   data:
+ * @param   len:ݳ
+ * @retval  
+ */
+static void oled_i2c_write(uint8_t dc, uint8_t *data, uint16_t len)
+{
+    /*ֽ(0x00/0x40)8λĴַͣ"ֽ+"ȫͬջͿ*/
+    HAL_I2C_Mem_Write(&OLED_I2C_HANDLE, OLED_I2C_ADDR, dc ? 0x40 : 0x00, I2C_MEMADD_SIZE_8BIT, data, len, 1000);
+}
+
+/**
+ * @breif   I2C DMAͣɺHAL_I2C_MemTxCpltCallback
+ * @param   dc:0- 1-Դ
+ * @param   data:ݣڼ뱣Ч
+ * @param   len:ݳ
+ * @retval  0-ɹ 1-ʧ
+ */
+static uint8_t oled_i2c_write_dma(uint8_t dc, uint8_t *data, uint16_t len)
+{
+    return HAL_I2C_Mem_Write_DMA(&OLED_I2C_HANDLE, OLED_I2C_ADDR, dc ? 0x40 : 0x00, I2C_MEMADD_SIZE_8BIT, data, len) != HAL_OK;
+}
+
+const oled_transport_t oled_transport_i2c = {oled_i2c_init, oled_i2c_write, NULL, 1};
+const oled_transport_t oled_transport_i2c_dma = {oled_i2c_init, oled_i2c_write, oled_i2c_write_dma, 1};
+#endif
+
+#if OLED_SPI_EN
+/**
+ * @breif   SPIӲλ
+ * @param   
+ * @retval  
+ */
+static void oled_spi_init(void)
+{
+    HAL_GPIO_WritePin(OLED_CS_PORT, OLED_CS_PIN, GPIO_PIN_SET);
+    HAL_Delay(100);
+    HAL_GPIO_WritePin(OLED_RES_PORT, OLED_RES_PIN, GPIO_PIN_RESET);
+    HAL_Delay(100);
+    HAL_GPIO_WritePin(OLED_RES_PORT, OLED_RES_PIN, GPIO_PIN_SET);
+    HAL_Delay(100);
+}
+
+/**
+ * @breif   SPI
+ * @param   dc:0- 1-Դ
+ * @param   data:
+ * @param   len:ݳ
+ * @retval  
+ */
+static void oled_spi_write(uint8_t dc, uint8_t *data, uint16_t len)
+{
+    HAL_GPIO_WritePin(OLED_DC_PORT, OLED_DC_PIN, dc ? GPIO_PIN_SET : GPIO_PIN_RESET);
+    HAL_GPIO_WritePin(OLED_CS_PORT, OLED_CS_PIN, GPIO_PIN_RESET);
+    HAL_SPI_Transmit(&OLED_SPI_HANDLE, data, len, 1000);
+    HAL_GPIO_WritePin(OLED_CS_PORT, OLED_CS_PIN, GPIO_PIN_SET);
+}
+
+/**
+ * @breif   SPI DMAͣɺHAL_SPI_TxCpltCallbackͷƬѡ
+ * @param   dc:0- 1-Դ
+ * @param   data:ݣڼ뱣Ч
+ * @param   len:ݳ
+ * @retval  0-ɹ 1-ʧ
+ */
+static uint8_t oled_spi_write_dma(uint8_t dc, uint8_t *data, uint16_t len)
+{
+    HAL_GPIO_WritePin(OLED_DC_PORT, OLED_DC_PIN, dc ? GPIO_PIN_SET : GPIO_PIN_RESET);
+    HAL_GPIO_WritePin(OLED_CS_PORT, OLED_CS_PIN, GPIO_PIN_RESET);
+    if (HAL_SPI_Transmit_DMA(&OLED_SPI_HANDLE, data, len) != HAL_OK)
+    {
+        HAL_GPIO_WritePin(OLED_CS_PORT, OLED_CS_PIN, GPIO_PIN_SET);
+        return 1;
+    }
+    return 0;
+}
+
+const oled_transport_t oled_transport_spi_dma = {oled_spi_init, oled_spi_write, oled_spi_write_dma, 0};
+#endif
+
+static const oled_transport_t *oled_transport = &OLED_TRANSPORT; /* ǰ䷽ʽ */
+
+/**
+ * @breif   ѡOLED䷽ʽoled_init֮ǰ
+ * @param   transport:ӿڣ&oled_transport_i2c
+ * @retval  
+ */
+void oled_set_transport(const oled_transport_t *transport)
+{
+    oled_transport = transport;
+}
+
+/**
+ * @breif   ȡǰOLED䷽ʽ
+ * @param   
+ * @retval  ӿ
+ */
+const oled_transport_t *oled_get_transport(void)
+{
+    return oled_transport;
+}
+
+#if OLED_ASYNC_EN
+/**
+ * @breif   ȴ첽ˢ½
+ * @param   
+ * @note    ʱźϣóCPUδ(oled_init)ʱֻѯ
+ *          ÿδֻͷһź߿кͷһΣλȴߣ
+ *          ź֮ǰ˵ȴʱµģ¼飬ʱȴԷ©ͷ
+ * @retval  
+ */
+static void oled_async_wait(void)
+{
+    while (oled_async_busy)
+    {
+        if (oled_async_idle != NULL && xTaskGetSchedulerState() == taskSCHEDULER_RUNNING)
+        {
+            if (xSemaphoreTake(oled_async_idle, OLED_ASYNC_WAIT_TICKS) == pdTRUE && !oled_async_busy)
+                xSemaphoreGive(oled_async_idle); // һȴ
+        }
+    }
+}
+#endif
+
+/**
+ * @breif   OLEDдͳƷֽ
+ * @param   command:
+ * @param   len:
+ * @retval  
+ */
+static void oled_write_command(uint8_t *command, uint16_t len)
+{
+#if OLED_ASYNC_EN
+    oled_async_wait(); // ȴ첽ˢͷ
+#endif
+    oled_transport->write(0, command, len);
+    oled_tx_bytes += len + oled_transport->overhead;
+}
+
+/**
+ * @breif   OLEDдԴݲͳƷֽ
+ * @param   data:Դ
+ * @param   len:ݳ
+ * @retval  
+ */
+static void oled_write_data(uint8_t *data, uint16_t len)
+{
+#if OLED_ASYNC_EN
+    oled_async_wait(); // ȴ첽ˢͷ
+#endif
+    oled_transport->write(1, data, len);
+    oled_tx_bytes += len + oled_transport->overhead;
+}
+
+/**
+ * @breif   OLEDд봰ڣѰַģʽЧ
+ * @param   page_start:ʼҳ 0-7
+ * @param   page_end:ҳ 0-7
+ * @param   x_start:ʼ 0-OLED_LIST
+ * @param   x_end: 0-OLED_LIST
+ * @retval  
+ */
+static void oled_set_window(uint8_t page_start, uint8_t page_end, uint8_t x_start, uint8_t x_end)
+{
+    uint8_t cmd[6];
+    cmd[0] = 0x21; /* еַΧ */
+    cmd[1] = x_start;
+    cmd[2] = x_end;
+    cmd[3] = 0x22; /* ҳַΧ */
+    cmd[4] = page_start;
+    cmd[5] = page_end;
+    oled_write_command(cmd, 6);
+}
+
+/**
+ * @breif   һзΧϲĳҳ¼
+ * @param   dirty_start:ʼ
+ * @param   dirty_end:
+ * @param   page:ҳ 0-7
+ * @param   x:ʼ
+ * @param   x_end:()
+ * @retval  
+ */
+static void oled_dirty_merge(uint8_t *dirty_start, uint8_t *dirty_end, uint8_t page, uint8_t x, uint8_t x_end)
+{
+    if (dirty_start[page] >= dirty_end[page]) // ҳԭ
+    {
+        dirty_start[page] = x;
+        dirty_end[page] = x_end;
+    }
+    else // ԭϲ
+    {
+        if (x < dirty_start[page])
+            dirty_start[page] = x;
+        if (x_end > dirty_end[page])
+            dirty_end[page] = x_end;
+    }
+}
+
+/**
+ * @breif   ָΪ´oled_flushʱ
+ * @param   x: 0-OLED_LIST
+ * @param   y: 0-OLED_HEIGHT
+ * @param   width: 0-OLED_LIST
+ * @param   height:߶ 0-OLED_HEIGHT
+ * @retval  
+ */
+static void oled_mark_dirty(uint8_t x, uint8_t y, uint8_t width, uint8_t height)
+{
+    uint8_t page;
+    uint16_t x_end = (uint16_t)x + width;
+    uint16_t y_end = (uint16_t)y + height;
+
+    if (oled_target != NULL) // ƲӰˢ
+        return;
+    if (width == 0 || height == 0 || x >= OLED_WIDTH || y >= OLED_HEIGHT) // Ļ¼
+        return;
+    if (x_end > OLED_WIDTH)
+        x_end = OLED_WIDTH;
+    if (y_end > OLED_HEIGHT)
+        y_end = OLED_HEIGHT;
+
+    for (page = y / 8; page <= (y_end - 1) / 8; page++)
+    {
+        oled_dirty_merge(oled_dirty_start, oled_dirty_end, page, x, x_end);
+    }
+}
+
+/**
+ * @breif   εԴֽ
+ * @param   span:
+ * @retval  ֽ
+ */
+static uint16_t oled_span_bytes(const oled_span_t *span)
+{
+    return (uint16_t)(span->page_end - span->page_start + 1) * (span->end - span->start);
+}
+
+#if OLED_ASYNC_EN
+/**
+ * @breif   ϴ첽ˢ³ʱδ͵±Ϊ
+ * @param   
+ * @note    ռǰãжϲֱӸдͼҲڶд
+ * @retval  
+ */
+static void oled_async_remark(void)
+{
+    uint8_t i, page;
+
+    if (oled_async_busy || oled_async_retry >= oled_async_count)
+        return;
+    for (i = oled_async_retry; i < oled_async_count; i++)
+    {
+        for (page = oled_async_span[i].page_start; page <= oled_async_span[i].page_end; page++)
+        {
+            oled_dirty_merge(oled_front_dirty_start, oled_front_dirty_end, page, oled_async_span[i].start,
+                             oled_async_span[i].end);
+        }
+    }
+    oled_async_retry = oled_async_count;
+}
+#endif
+
+#if OLED_TRANSPOSE_EN
+
+/**
+ * @breif   8x8λתã32λַֿ齻
+ * @param   in:8ֽڣin[j]ĵkλ
+ * @param   out:8ֽڣдout[k]ĵjλ
+ * @retval  
+ */
+static void oled_transpose8(const uint8_t *in, uint8_t *out)
+{
+    uint32_t x, y, t;
+
+    x = in[0] | ((uint32_t)in[1] << 8) | ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24); // jֽڵkλ8j+kλ
+    y = in[4] | ((uint32_t)in[5] << 8) | ((uint32_t)in[6] << 16) | ((uint32_t)in[7] << 24);
+
+    t = (x ^ (x >> 7)) & 0x00AA00AA; // 2x2ĶԽλ
+    x ^= t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AA;
+    y ^= t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC; // 4x4е2x2ӿ
+    x ^= t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCC;
+    y ^= t ^ (t << 14);
+    t = ((x >> 4) ^ y) & 0x0F0F0F0F; // ֮4x4ӿ
+    y ^= t;
+    x ^= t << 4;
+
+    out[0] = (uint8_t)x;
+    out[1] = (uint8_t)(x >> 8);
+    out[2] = (uint8_t)(x >> 16);
+    out[3] = (uint8_t)(x >> 24);
+    out[4] = (uint8_t)y;
+    out[5] = (uint8_t)(y >> 8);
+    out[6] = (uint8_t)(y >> 16);
+    out[7] = (uint8_t)(y >> 24);
+}
+
+/**
+ * @breif   ȡǰ¼ʱΪĻ
+ * @param   spans:ΣOLED_PAGES
+ * @note    ԴnҳӦĻ8n8n+7УҳзΧӦĻҳΧ
+ *          ڵ8пתݲOLED_GATHER_SIZEֽֽڲʱϲΪһ
+ * @retval  
+ */
+static uint8_t oled_collect_spans(oled_span_t *spans)
+{
+    uint8_t page, first, last, count = 0;
+    uint8_t page_start, page_end;
+    uint16_t bytes;
+    oled_span_t *prev;
+
+#if OLED_ASYNC_EN
+    oled_async_remark(); // Ȳϴ첽ˢ³δ͵
+#endif
+    for (page = 0; page < OLED_PAGES; page++)
+    {
+        if (oled_front_dirty_start[page] >= oled_front_dirty_end[page])
+            continue;
+        first = oled_front_dirty_start[page] / 8;
+        last = (oled_front_dirty_end[page] - 1) / 8;
+        oled_front_dirty_start[page] = 0;
+        oled_front_dirty_end[page] = 0;
+
+        if (count > 0 && spans[count - 1].end == page * 8) // һ
+        {
+            prev = &spans[count - 1];
+            page_start = (first < prev->page_start) ? first : prev->page_start;
+            page_end = (last > prev->page_end) ? last : prev->page_end;
+            bytes = (uint16_t)(page_end - page_start + 1) * (prev->end - prev->start + 8);
+            if (bytes <= OLED_GATHER_SIZE && bytes <= oled_span_bytes(prev) + (last - first + 1) * 8 + OLED_SPAN_OVERHEAD)
+            {
+                prev->page_start = page_start;
+                prev->page_end = page_end;
+                prev->end += 8;
+                continue;
+            }
+        }
+        spans[count].page_start = first;
+        spans[count].page_end = last;
+        spans[count].start = page * 8;
+        spans[count].end = page * 8 + 8;
+        count++;
+    }
+    return count;
+}
+
+/**
+ * @breif   ȡεĻݣԴ8x8תõƴӻ
+ * @param   span:ΣĻ
+ * @retval  ݵַǰЧ
+ */
+static uint8_t *oled_span_data(const oled_span_t *span)
+{
+    uint8_t page, block;
+    uint8_t *out = oled_gather_buf;
+
+    for (page = span->page_start; page <= span->page_end; page++) // Ѱַһҳĸ
+    {
+        for (block = span->start / 8; block < span->end / 8; block++)
+        {
+            oled_transpose8(&oled_front_buffer[block][page * 8], out);
+            out += 8;
+        }
+    }
+    return oled_gather_buf;
+}
+
+#else
+
+/**
+ * @breif   ȡǰ¼
+ * @param   spans:ΣOLED_PAGES
+ * @note    ҳխκϲΪһҳ(ʱƴӣOLED_GATHER_SIZEֽ)
+ *          η͵ֽڰҳʱϲΪһΣ
+ *          һһδ
+ * @retval  
+ */
+static uint8_t oled_collect_spans(oled_span_t *spans)
+{
+    uint8_t page, i, count = 0, merged = 0;
+    uint8_t page_first = OLED_PAGES, page_last = 0;
+    uint8_t start, end;
+    uint16_t span_cost = 0, block_cost, bytes;
+
+#if OLED_ASYNC_EN
+    oled_async_remark(); // Ȳϴ첽ˢ³δ͵
+#endif
+    for (page = 0; page < OLED_PAGES; page++)
+    {
+        if (oled_front_dirty_start[page] < oled_front_dirty_end[page])
+        {
+            spans[count].page_start = page;
+            spans[count].page_end = page;
+            spans[count].start = oled_front_dirty_start[page];
+            spans[count].end = oled_front_dirty_end[page];
+            if (page_first == OLED_PAGES)
+                page_first = page;
+            page_last = page;
+            count++;
+            oled_front_dirty_start[page] = 0;
+            oled_front_dirty_end[page] = 0;
+        }
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        if (merged > 0 && spans[merged - 1].page_end + 1 == spans[i].page_start &&
+            spans[i].page_start != OLED_PAGES - oled_scroll_page) // ڲܿGDDRAM0ҳ
+        {
+            start = (spans[i].start < spans[merged - 1].start) ? spans[i].start : spans[merged - 1].start;
+            end = (spans[i].end > spans[merged - 1].end) ? spans[i].end : spans[merged - 1].end;
+            bytes = (uint16_t)(spans[i].page_end - spans[merged - 1].page_start + 1) * (end - start);
+            if (bytes <= OLED_GATHER_SIZE &&
+                bytes + OLED_SPAN_OVERHEAD <= oled_span_bytes(&spans[merged - 1]) + oled_span_bytes(&spans[i]) + 2 * OLED_SPAN_OVERHEAD)
+            {
+                spans[merged - 1].page_end = spans[i].page_end;
+                spans[merged - 1].start = start;
+                spans[merged - 1].end = end;
+                continue;
+            }
+        }
+        spans[merged++] = spans[i];
+    }
+    for (i = 0; i < merged; i++)
+    {
+        span_cost += oled_span_bytes(&spans[i]) + OLED_SPAN_OVERHEAD;
+    }
+    count = merged;
+
+    if (count > 1)
+    {
+        block_cost = (page_last - page_first + 1) * OLED_LIST + OLED_SPAN_OVERHEAD;
+        if (block_cost <= span_cost)
+        {
+            spans[0].page_start = page_first;
+            spans[0].page_end = page_last;
+            spans[0].start = 0;
+            spans[0].end = OLED_LIST;
+            count = 1;
+            page = OLED_PAGES - oled_scroll_page; // ӦGDDRAM0ҳԴҳڲܿ
+            if (oled_scroll_page != 0 && page_first < page && page <= page_last)
+            {
+                spans[0].page_end = page - 1;
+                spans[1] = spans[0];
+                spans[1].page_start = page;
+                spans[1].page_end = page_last;
+                count = 2;
+            }
+        }
+    }
+    return count;
+}
+
+/**
+ * @breif   ȡεԴݣҳխԴвƴ
+ * @param   span:
+ * @retval  ݵַǰЧ
+ */
+static uint8_t *oled_span_data(const oled_span_t *span)
+{
+    uint8_t page;
+    uint8_t width = span->end - span->start;
+
+    if (span->page_start == span->page_end || width == OLED_LIST) // Դ
+        return &oled_front_buffer[span->page_start][span->start];
+    for (page = span->page_start; page <= span->page_end; page++)
+    {
+        memcpy(&oled_gather_buf[(page - span->page_start) * width], &oled_front_buffer[page][span->start], width);
+    }
+    return oled_gather_buf;
+}
+
+#endif
+
+/**
+ * @breif   ԴҳӦGDDRAMҳ
+ * @param   page:Դҳ 0-7
+ * @retval  GDDRAMҳ 0-7
+ */
+static uint8_t oled_ram_page(uint8_t page)
+{
+    return (page + oled_scroll_page) % OLED_PAGES;
+}
+
+#if !OLED_TRANSPOSE_EN || OLED_DOUBLE_BUFFER_EN
+/**
+ * @breif   ¼ԴһҳƳļ¼תײ
+ * @param   dirty_start:ʼ
+ * @param   dirty_end:
+ * @param   pages:ҳ 0-7
+ * @retval  
+ */
+static void oled_dirty_rotate(uint8_t *dirty_start, uint8_t *dirty_end, uint8_t pages)
+{
+    uint8_t start[OLED_PAGES], end[OLED_PAGES];
+    uint8_t page;
+
+    memcpy(start, dirty_start, OLED_PAGES);
+    memcpy(end, dirty_end, OLED_PAGES);
+    for (page = 0; page < OLED_PAGES; page++)
+    {
+        dirty_start[page] = start[(page + pages) % OLED_PAGES];
+        dirty_end[page] = end[(page + pages) % OLED_PAGES];
+    }
+}
+#endif
+
+/**
+ * @breif   ǰ̨Ӧʾʼ
+ * @note    ˫ʱڽЧˢºڷԴǰʼ
+ * @param   
+ * @retval  
+ */
+static void oled_scroll_apply(void)
+{
+#if OLED_DOUBLE_BUFFER_EN
+    uint8_t cmd;
+
+    if (oled_front_scroll == 0)
+        return;
+    oled_scroll_page = (oled_scroll_page + oled_front_scroll) % OLED_PAGES;
+    oled_front_scroll = 0;
+    cmd = 0x40 | (oled_scroll_page * 8); /* ʾʼ */
+    oled_write_command(&cmd, 1);
+#endif
+}
+
+/**
+ * @breif   ȡͼĿһҳ
+ * @param   page:ҳ
+ * @retval  ҳ׵ַ
+ */
+static uint8_t *oled_target_page(uint8_t page)
+{
+    return (oled_target != NULL) ? oled_target[page] : oled_display_buffer[page];
+}
+
+/**
+ * @breif   õǰդϳһֽ
+ * @param   d:Դԭ
+ * @param   s:Դ
+ * @param   mask:дλ
+ * @retval  ϳɺ
+ */
+static uint8_t oled_rop_byte(uint8_t d, uint8_t s, uint8_t mask)
+{
+    uint8_t anf = oled_rop_anf[oled_ctx.rop];
+    uint8_t r = 0;
+
+    if (anf & 0x01)
+        r ^= d;
+    if (anf & 0x02)
+        r ^= s;
+    if (anf & 0x04)
+        r ^= d & s;
+    return d ^ ((r ^ d) & mask);
+}
+
+/**
+ * @breif   òüβüͼ
+ * @param   x:ʼУ
+ * @param   y:ʼУ
+ * @param   x_end:()
+ * @param   y_end:()
+ * @retval  0-üΪ 1-ǿ
+ */
+static uint8_t oled_clip(uint16_t *x, uint16_t *y, uint16_t *x_end, uint16_t *y_end)
+{
+    if (*x < oled_ctx.clip_x)
+        *x = oled_ctx.clip_x;
+    if (*y < oled_ctx.clip_y)
+        *y = oled_ctx.clip_y;
+    if (*x_end > oled_ctx.clip_x_end)
+        *x_end = oled_ctx.clip_x_end;
+    if (*y_end > oled_ctx.clip_y_end)
+        *y_end = oled_ctx.clip_y_end;
+    return *x < *x_end && *y < *y_end;
+}
+
+/**
+ * @breif   ĳҳзΧӦλ
+ * @param   page:ҳ 0-7
+ * @param   y_start:ʼ
+ * @param   y_end:()
+ * @retval  룬bit0Ӧҳ0
+ */
+static uint8_t oled_page_mask(uint8_t page, uint16_t y_start, uint16_t y_end)
+{
+    uint16_t row_start = (page * 8 > y_start) ? page * 8 : y_start;
+    uint16_t row_end = (page * 8 + 8 < y_end) ? page * 8 + 8 : y_end;
+
+    return (uint8_t)((0xFF << (row_start % 8)) & (0xFF >> (page * 8 + 8 - row_end)));
+}
+
+/**
+ * @breif   ҳԾ d = (d & (keep | ~mask)) ^ (flip & mask)
+ * @param   x0:ʼ
+ * @param   y0:ʼ
+ * @param   x1:()
+ * @param   y1:()
+ * @param   keep:ڱԭֵλ 0x00- 0xFF-
+ * @param   flip:ڷתλ
+ * @note    keep=0,flip=0λkeep=0,flip=0xFFȡkeep=0xFF,flip=0xFF
+ *          ÿҳֻһ±룬ҳʱ˻Ϊmemset
+ * @retval  
+ */
+static void oled_fill_area(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t keep, uint8_t flip)
+{
+    uint8_t page, mask, and_mask, xor_mask, j, count;
+    uint8_t *row;
+
+    if (x1 > OLED_WIDTH)
+        x1 = OLED_WIDTH;
+    if (y1 > oled_target_height)
+        y1 = oled_target_height;
+    if (x0 >= x1 || y0 >= y1) // Ļݲʾ
+        return;
+
+    count = x1 - x0;
+    for (page = y0 / 8; page <= (y1 - 1) / 8; page++)
+    {
+        mask = oled_page_mask(page, y0, y1);
+        and_mask = keep | (uint8_t)~mask;
+        xor_mask = flip & mask;
+        row = &oled_target_page(page)[x0];
+
+        if (and_mask == 0x00) // ҳ
+        {
+            memset(row, xor_mask, count);
+        }
+        else if (and_mask == 0xFF) // ֻת
+        {
+            if (xor_mask != 0)
+            {
+                for (j = 0; j < count; j++)
+                    row[j] ^= xor_mask;
+            }
+        }
+        else
+        {
+            for (j = 0; j < count; j++)
+                row[j] = (row[j] & and_mask) ^ xor_mask;
+        }
+    }
+    oled_mark_dirty(x0, y0, x1 - x0, y1 - y0);
+}
+
+/**
+ * @breif   ǰͼ(ԴΪȫ1)
+ * @param   x0:ʼУΪ
+ * @param   y0:ʼУΪ
+ * @param   x1:()
+ * @param   y1:()
+ * @retval  
+ */
+static void oled_fill_rect(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+    uint8_t anf = oled_rop_anf[oled_ctx.rop];
+    uint16_t cx0, cy0, cx1, cy1;
+
+    if (x1 <= 0 || y1 <= 0 || x0 >= x1 || y0 >= y1)
+        return;
+    cx0 = (x0 > 0) ? x0 : 0;
+    cy0 = (y0 > 0) ? y0 : 0;
+    cx1 = x1;
+    cy1 = y1;
+    if (!oled_clip(&cx0, &cy0, &cx1, &cy1))
+        return;
+    /* s=1ʱ r = (d & (k1 ^ k3)) ^ k2 */
+    oled_fill_area(cx0, cy0, cx1, cy1, (((anf ^ (anf >> 2)) & 0x01) ? 0xFF : 0x00), ((anf & 0x02) ? 0xFF : 0x00));
+}
+
+/**
+ * @breif   һԴдһҳԴ棬ÿδ4
+ * @param   dst:Դʼַ
+ * @param   lo:ڱҳλԴҳ(shift)NULLʾ
+ * @param   hi:ڱҳλһԴҳ(8-shift)NULLʾ
+ * @param   shift:ƫ 0-7
+ * @param   mask:ҳҪдλ
+ * @param   count:
+ * @retval  
+ */
+static void oled_blit_row(uint8_t *dst, const uint8_t *lo, const uint8_t *hi, uint8_t shift, uint8_t mask, uint8_t count)
+{
+    uint8_t j = 0;
+    uint8_t src;
+    uint8_t anf = oled_rop_anf[oled_ctx.rop];
+    uint32_t d, s, w, r;
+    uint32_t mask32 = mask * 0x01010101UL;
+    uint32_t lo_mask = (uint8_t)(0xFF << shift) * 0x01010101UL;      /* ƺÿֽڱλȥλ */
+    uint32_t hi_mask = (uint8_t)(0xFF >> (8 - shift)) * 0x01010101UL; /* ƺÿֽڱλ */
+    uint32_t k1 = (anf & 0x01) ? 0xFFFFFFFFUL : 0;                    /* դϵѭ޷֧ */
+    uint32_t k2 = (anf & 0x02) ? 0xFFFFFFFFUL : 0;
+    uint32_t k3 = (anf & 0x04) ? 0xFFFFFFFFUL : 0;
+
+    if (mask == 0xFF && shift == 0 && oled_ctx.rop == OLED_ROP_COPY) // ҳҳǣֱӿ
+    {
+        memcpy(dst, lo, count);
+        return;
+    }
+
+    for (; j + 4 <= count; j += 4) // 32λֲУCortex-M3ַ֧Ƕַ
+    {
+        s = 0;
+        if (lo != NULL)
+        {
+            memcpy(&w, &lo[j], 4);
+            s |= (w << shift) & lo_mask;
+        }
+        if (hi != NULL)
+        {
+            memcpy(&w, &hi[j], 4);
+            s |= (w >> (8 - shift)) & hi_mask;
+        }
+        memcpy(&d, &dst[j], 4);
+        r = (d & k1) ^ (s & k2) ^ (d & s & k3);
+        d ^= (r ^ d) & mask32; // ƺϲΪһд
+        memcpy(&dst[j], &d, 4);
+    }
+    for (; j < count; j++) // ʣ಻4
+    {
+        src = 0;
+        if (lo != NULL)
+            src |= lo[j] << shift;
+        if (hi != NULL)
+            src |= hi[j] >> (8 - shift);
+        dst[j] = oled_rop_byte(dst[j], src, mask);
+    }
+}
+
+/**
+ * @breif   ǰͼİͼдԴ沢
+ * @param   x: 0-OLED_LIST
+ * @param   y: 0-OLED_HEIGHT
+ * @param   image:ͼݣҳУÿҳwidthֽ
+ * @param   width: 0-OLED_LIST
+ * @param   height:߶ 0-OLED_HEIGHT
+ * @note    üѭɣheightԴλд
+ * @retval  
+ */
+static void oled_blit(uint8_t x, uint8_t y, const uint8_t *image, uint8_t width, uint8_t height)
+{
+    uint8_t page, src_page, src_pages;
+    uint8_t shift, mask;
+    uint16_t x0 = x, y0 = y, x1 = x + width, y1 = y + height;
+
+    if (!oled_clip(&x0, &y0, &x1, &y1)) // üεݲʾ
+        return;
+
+    shift = y % 8;
+    src_pages = (height + 7) / 8;
+
+    for (page = y0 / 8; page <= (y1 - 1) / 8; page++)
+    {
+        mask = oled_page_mask(page, y0, y1); // ҳҪд
+
+        src_page = page - y / 8;
+        oled_blit_row(&oled_target_page(page)[x0],
+                      (src_page < src_pages) ? &image[src_page * width + (x0 - x)] : NULL,
+                      (shift != 0 && src_page > 0) ? &image[(src_page - 1) * width + (x0 - x)] : NULL,
+                      shift, mask, x1 - x0);
+    }
+    oled_mark_dirty(x0, y0, x1 - x0, y1 - y0);
+}
+
+/**
+ * @breif   ѻۻλǰͼдԴ
+ * @param   pen:
+ * @note    ͬһֽڵĶֻһζд
+ * @retval  
+ */
+static void oled_pen_flush(oled_pen_t *pen)
+{
+    uint8_t mask = pen->bits;
+    uint8_t *row;
+
+    pen->bits = 0;
+    if (mask == 0 || pen->x < oled_ctx.clip_x || pen->x >= oled_ctx.clip_x_end ||
+        pen->page < oled_ctx.clip_y / 8 || pen->page > (oled_ctx.clip_y_end - 1) / 8) // üεݲʾ
+        return;
+    mask &= oled_page_mask(pen->page, oled_ctx.clip_y, oled_ctx.clip_y_end);
+    if (mask == 0)
+        return;
+    row = oled_target_page(pen->page);
+    row[pen->x] = oled_rop_byte(row[pen->x], 0xFF, mask);
+    if (oled_target == NULL)
+        oled_dirty_merge(oled_dirty_start, oled_dirty_end, pen->page, pen->x, pen->x + 1);
+}
+
+/**
+ * @breif   ѻƶָ㣬
+ * @param   pen:
+ * @param   x:УΪ
+ * @param   y:УΪ
+ * @retval  
+ */
+static void oled_pen_move(oled_pen_t *pen, int16_t x, int16_t y)
+{
+    oled_pen_flush(pen);
+    pen->x = x;
+    pen->page = (y >= 0) ? y / 8 : -((7 - y) / 8); // ȡ
+    pen->mask = 0x01 << (y & 7);
+}
+
+/**
+ * @breif   ʺƶһ
+ * @param   pen:
+ * @param   step:1- -1-
+ * @retval  
+ */
+static void oled_pen_step_x(oled_pen_t *pen, int8_t step)
+{
+    oled_pen_flush(pen);
+    pen->x += step;
+}
+
+/**
+ * @breif   ƶһУҳʱдԴ
+ * @param   pen:
+ * @param   step:1- -1-
+ * @retval  
+ */
+static void oled_pen_step_y(oled_pen_t *pen, int8_t step)
+{
+    if (step > 0)
+    {
+        pen->mask <<= 1;
+        if (pen->mask == 0)
+        {
+            oled_pen_flush(pen);
+            pen->page++;
+            pen->mask = 0x01;
+        }
+    }
+    else
+    {
+        pen->mask >>= 1;
+        if (pen->mask == 0)
+        {
+            oled_pen_flush(pen);
+            pen->page--;
+            pen->mask = 0x80;
+        }
+    }
+}
+
+/**
+ * @breif   Bresenhamߣҳֽںλн
+ * @param   x0:
+ * @param   y0:
+ * @param   x1:յ
+ * @param   y1:յ
+ * @param   last:Ƿյ 0-(Ӵֻһ) 1-
+ * @retval  
+ */
+static void oled_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t last)
+{
+    oled_pen_t pen = {0};
+    int16_t dx = (x1 > x0) ? x1 - x0 : x0 - x1;
+    int16_t dy = (y1 > y0) ? y0 - y1 : y1 - y0; // ȡֵ
+    int8_t sx = (x1 > x0) ? 1 : -1;
+    int8_t sy = (y1 > y0) ? 1 : -1;
+    int32_t err = dx + dy, e2;
+
+    if ((x0 < oled_ctx.clip_x && x1 < oled_ctx.clip_x) || (x0 >= oled_ctx.clip_x_end && x1 >= oled_ctx.clip_x_end) ||
+        (y0 < oled_ctx.clip_y && y1 < oled_ctx.clip_y) || (y0 >= oled_ctx.clip_y_end && y1 >= oled_ctx.clip_y_end)) // ڲü
+        return;
+
+    oled_pen_move(&pen, x0, y0);
+    while (x0 != x1 || y0 != y1)
+    {
+        pen.bits |= pen.mask;
+        e2 = 2 * err;
+        if (e2 >= dy)
+        {
+            err += dy;
+            x0 += sx;
+            oled_pen_step_x(&pen, sx);
+        }
+        if (e2 <= dx)
+        {
+            err += dx;
+            y0 += sy;
+            oled_pen_step_y(&pen, sy);
+        }
+    }
+    if (last)
+        pen.bits |= pen.mask;
+    oled_pen_flush(&pen);
+}
+
+/**
+ * @breif   Ƕȡֵ
+ * @param   angle:Ƕȣλ
+ * @retval  sin(angle)*16384
+ */
+static int16_t oled_sin(int16_t angle)
+{
+    angle %= 360;
+    if (angle < 0)
+        angle += 360;
+    if (angle <= 90)
+        return oled_sin_table[angle];
+    if (angle <= 180)
+        return oled_sin_table[180 - angle];
+    if (angle <= 270)
+        return -oled_sin_table[angle - 180];
+    return -oled_sin_table[360 - angle];
+}
+
+/**
+ * @breif   жϵǷԲĽǶȷΧ
+ * @param   arc:Բ
+ * @param   px:Բĵƫ
+ * @param   py:ԲĵƫƣΪ
+ * @retval  0- 1-
+ */
+static uint8_t oled_arc_contains(const oled_arc_t *arc, int32_t px, int32_t py)
+{
+    uint8_t after_start = arc->start_x * py - arc->start_y * px >= 0; // ʼʱһ
+    uint8_t before_end = px * arc->end_y - py * arc->end_x >= 0;      // ڽ˳ʱһ
+
+    return arc->wide ? (after_start || before_end) : (after_start && before_end);
+}
+
+/**
+ * @breif   Բĳеİ
+ * @param   a2:ˮƽ뾶ƽ
+ * @param   b2:ֱ뾶ƽ
+ * @param   dx:Բĵƫ 0-ˮƽ뾶
+ * @param   h:һеİߣdx
+ * @retval  ߣ߽뵽
+ */
+static int16_t oled_ellipse_height(uint32_t a2, uint32_t b2, int16_t dx, int16_t h)
+{
+    /* (dx, h-0.5)ԲʱСha2*(2h-1)^2 + 4*b2*dx^2 > 4*a2*b2 */
+    while (h > 0 && a2 * (uint32_t)((2 * h - 1) * (2 * h - 1)) + 4 * b2 * (uint32_t)(dx * dx) > 4 * a2 * b2)
+        h--;
+    return h;
+}
+
+/**
+ * @breif   ԲһУзΧΪ[y-h, y-start][y+start, y+h]
+ * @param   x:
+ * @param   y:Բ
+ * @param   dx:Բĵƫ
+ * @param   start:ʼߣΪ0ʱ
+ * @param   h:
+ * @param   arc:ԲNULLʾǶɸѡ
+ * @retval  
+ */
+static void oled_ellipse_column(int16_t x, int16_t y, int16_t dx, int16_t start, int16_t h, const oled_arc_t *arc)
+{
+    oled_pen_t pen = {0};
+    int16_t row;
+
+    if (arc == NULL) // ֱֱӰҳ
+    {
+        if (start == 0)
+        {
+            oled_fill_rect(x, y - h, x + 1, y + h + 1);
+        }
+        else
+        {
+            oled_fill_rect(x, y - h, x + 1, y - start + 1);
+            oled_fill_rect(x, y + start, x + 1, y + h + 1);
+        }
+        return;
+    }
+
+    oled_pen_move(&pen, x, y - h);
+    for (row = -h; row <= h; row++)
+    {
+        if (row == 1 - start && start > 0) // ֮Ŀ
+        {
+            row = start;
+            oled_pen_move(&pen, x, y + row);
+        }
+        if (oled_arc_contains(arc, dx, -row))
+            pen.bits |= pen.mask;
+        oled_pen_step_y(&pen, 1);
+    }
+    oled_pen_flush(&pen);
+}
+
+/**
+ * @breif   ɨԲԲÿֻдһ
+ * @param   x:Բ
+ * @param   y:Բ
+ * @param   rx:ˮƽ뾶 0-127
+ * @param   ry:ֱ뾶 0-127
+ * @param   fill:Ƿ 0- 1-
+ * @param   arc:ԲNULLʾԲ
+ * @retval  
+ */
+static void oled_ellipse(int16_t x, int16_t y, uint8_t rx, uint8_t ry, uint8_t fill, const oled_arc_t *arc)
+{
+    uint32_t a2, b2;
+    int16_t dx, h, next, start;
+
+    if (rx > 127)
+        rx = 127;
+    if (ry > 127)
+        ry = 127;
+    if (x + rx < oled_ctx.clip_x || x - rx >= oled_ctx.clip_x_end || y + ry < oled_ctx.clip_y || y - ry >= oled_ctx.clip_y_end)
+        return;
+
+    a2 = (uint32_t)rx * rx;
+    b2 = (uint32_t)ry * ry;
+    h = ry;
+    for (dx = 0; dx <= rx; dx++)
+    {
+        next = (dx < rx) ? oled_ellipse_height(a2, b2, dx + 1, h) : -1;
+        /* ȡеһֱ֮Σ֤ͨ */
+        start = fill ? 0 : ((next + 1 < h) ? next + 1 : h);
+        oled_ellipse_column(x + dx, y, dx, start, h, arc);
+        if (dx != 0)
+            oled_ellipse_column(x - dx, y, -dx, start, h, arc);
+        h = next;
+    }
+}
+
+/**
+ * @breif   ںֿжֲGBK
+ * @param   table:ֿ⣬GBKСУĩβΪδַ֪
+ * @param   count:δַ֪
+ * @param   code:GBK룬ֽǰ
+ * @retval  ģֿûʱĩβδַ֪
+ */
+const OLED_Character_t *oled_find_cjk(const OLED_Character_t *table, uint16_t count, uint16_t code)
+{
+    uint16_t low = 0, high = count, mid, key;
+
+    while (low < high)
+    {
+        mid = (low + high) / 2;
+        key = (table[mid].Index[0] << 8) | table[mid].Index[1];
+        if (key == code)
+            return &table[mid];
+        if (key < code)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    return &table[count];
+}
+
+/**
+ * @breif   ڱɵֿжֲַ
+ * @param   font:ֿ
+ * @param   code:룬ASCIIΪֽڣΪGBK˫ֽ
+ * @retval  ַţֿûʱĩβδַ֪count
+ */
+static uint16_t oled_font_find(const oled_font_t *font, uint16_t code)
+{
+    uint16_t low = 0, high = font->count, mid;
+
+    while (low < high)
+    {
+        mid = (low + high) / 2;
+        if (font->code[mid] == code)
+            return mid;
+        if (font->code[mid] < code)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    return font->count;
+}
+
+/**
+ * @breif   ʽʱÿԴҳдԴλ
+ * @param   y:ͼʼ
+ * @param   height:ͼ߶
+ * @param   y0:üʼ
+ * @param   y1:üĽ()
+ * @param   lo_mask:Դҳshiftд뱾ҳλԴҳ
+ * @param   hi_mask:Դҳ8-shiftдһҳλ
+ * @note    ֵλصɷֱդ
+ * @retval  
+ */
+static void oled_stream_masks(uint8_t y, uint8_t height, uint16_t y0, uint16_t y1, uint8_t *lo_mask, uint8_t *hi_mask)
+{
+    uint8_t src_page, page, shift = y % 8;
+
+    for (src_page = 0; src_page < (height + 7) / 8; src_page++)
+    {
+        page = y / 8 + src_page;
+        lo_mask[src_page] = (page >= y0 / 8 && page <= (y1 - 1) / 8) ? oled_page_mask(page, y0, y1) & (0xFF << shift) : 0;
+        hi_mask[src_page] = (shift != 0 && page + 1 >= y0 / 8 && page + 1 <= (y1 - 1) / 8) ? oled_page_mask(page + 1, y0, y1) & (0xFF >> (8 - shift)) : 0;
+    }
+}
+
+/**
+ * @breif   һԴֽڰдԴıҳһҳ
+ * @param   page:ԴֽڶӦԴҳ
+ * @param   x:
+ * @param   value:Դֽ
+ * @param   shift:ƫ 0-7
+ * @param   lo_mask:ҳ
+ * @param   hi_mask:һҳ
+ * @retval  
+ */
+static void oled_stream_put(uint8_t page, uint8_t x, uint8_t value, uint8_t shift, uint8_t lo_mask, uint8_t hi_mask)
+{
+    uint8_t *row;
+
+    if (lo_mask != 0)
+    {
+        row = oled_target_page(page);
+        row[x] = oled_rop_byte(row[x], value << shift, lo_mask);
+    }
+    if (hi_mask != 0)
+    {
+        row = oled_target_page(page + 1);
+        row[x] = oled_rop_byte(row[x], value >> (8 - shift), hi_mask);
+    }
+}
+
+/**
+ * @breif   ǰͼİRLEѹͼ߽дԴ棬ʹýѹ
+ * @param   x: 0-OLED_LIST
+ * @param   y: 0-OLED_HEIGHT
+ * @param   data:ѹݣѹoled_show_imageͼʽͬ
+ * @param   width: 1-OLED_LIST
+ * @param   height:߶ 1-OLED_HEIGHT
+ * @note    ֽc<0x80ʱc+1ԭֽڣc>=0x80ʱ1ֽڲظ(c&0x7F)+3Σظɿҳ
+ * @retval  
+ */
+static void oled_blit_rle(uint8_t x, uint8_t y, const uint8_t *data, uint8_t width, uint8_t height)
+{
+    uint8_t ctrl, value = 0, count, literal;
+    uint8_t col = 0, src_page = 0, src_pages = (height + 7) / 8;
+    uint8_t lo_mask[OLED_TARGET_PAGES_MAX], hi_mask[OLED_TARGET_PAGES_MAX];
+    uint16_t x0 = x, y0 = y, x1 = x + width, y1 = y + height;
+
+    if (!oled_clip(&x0, &y0, &x1, &y1)) // üεݲʾ
+        return;
+    oled_stream_masks(y, height, y0, y1, lo_mask, hi_mask);
+
+    while (src_page < src_pages)
+    {
+        ctrl = *data++;
+        literal = ctrl < 0x80;
+        count = literal ? ctrl + 1 : (ctrl & 0x7F) + 3;
+        if (!literal)
+            value = *data++;
+
+        for (; count > 0; count--)
+        {
+            if (literal)
+                value = *data++;
+            if (x + col >= x0 && x + col < x1)
+                oled_stream_put(y / 8 + src_page, x + col, value, y % 8, lo_mask[src_page], hi_mask[src_page]);
+            if (++col == width)
+            {
+                col = 0;
+                if (++src_page == src_pages)
+                    break;
+            }
+        }
+    }
+    oled_mark_dirty(x0, y0, x1 - x0, y1 - y0);
+}
+
+/**
+ * @breif   ǰͼİѰλŵͼ߽дԴ
+ * @param   x: 0-OLED_LIST
+ * @param   y: 0-OLED_HEIGHT
+ * @param   data:Уÿheightλλϣ֮䲻
+ * @param   width: 1-OLED_LIST
+ * @param   height:߶ 1-OLED_HEIGHT
+ * @note    ߶Ȳ8ıʱҳʽʡȥһҳĿλ12еģʡ25%
+ * @retval  
+ */
+static void oled_blit_packed(uint8_t x, uint8_t y, const uint8_t *data, uint8_t width, uint8_t height)
+{
+    uint8_t col, src_page, rows, value;
+    uint8_t src_pages = (height + 7) / 8;
+    uint8_t lo_mask[OLED_TARGET_PAGES_MAX], hi_mask[OLED_TARGET_PAGES_MAX];
+    uint16_t bits = 0;  /* λ */
+    uint8_t nbits = 0;  /* λеЧλ */
+    uint16_t x0 = x, y0 = y, x1 = x + width, y1 = y + height;
+
+    if (!oled_clip(&x0, &y0, &x1, &y1)) // üεݲʾ
+        return;
+    oled_stream_masks(y, height, y0, y1, lo_mask, hi_mask);
+
+    for (col = 0; col < width && x + col < x1; col++)
+    {
+        for (src_page = 0; src_page < src_pages; src_page++)
+        {
+            rows = (src_page == src_pages - 1) ? height - src_page * 8 : 8;
+            if (nbits < rows)
+            {
+                bits |= (uint16_t)*data++ << nbits;
+                nbits += 8;
+            }
+            value = bits & (0xFF >> (8 - rows));
+            bits >>= rows;
+            nbits -= rows;
+            if (x + col >= x0)
+                oled_stream_put(y / 8 + src_page, x + col, value, y % 8, lo_mask[src_page], hi_mask[src_page]);
+        }
+    }
+    oled_mark_dirty(x0, y0, x1 - x0, y1 - y0);
+}
+
 void oled_test_pattern(void)
 {
-    // ͼȫ㣩
-    uint8_t i, j;
-    for (i = 0; i < OLED_PAGES; i++)
+    // ͼȫ㣩
+    uint8_t i, j;
+    for (i = 0; i < OLED_PAGES; i++)
+    {
+        for (j = 0; j < OLED_LIST; j++)
+        {
+            oled_display_buffer[i][j] = (i % 2 == 0) ? 0xAA : 0x55;
+        }
+    }
+    oled_update_all();  // ǿˢʾ
+}
+/**
+ * @breif   ʼOLED
+ * @param   
+ * @retval  
+ */
+void oled_init(void)
+{
+#if OLED_ASYNC_EN
+    if (oled_async_idle == NULL)
+        oled_async_idle = xSemaphoreCreateBinaryStatic(&oled_async_idle_buf);
+#endif
+#if OLED_FRAME_LOCK_EN
+    if (oled_frame_mutex == NULL)
+        oled_frame_mutex = xSemaphoreCreateRecursiveMutexStatic(&oled_frame_mutex_buf);
+#endif
+    oled_transport->init();
+    oled_scroll_page = 0; // ʼʼΪ0
+    oled_scroll_active = 0;
+    oled_write_command((uint8_t *)oled_init_cmd, sizeof(oled_init_cmd) / sizeof(oled_init_cmd[0]));
+    oled_clear_all();
+    oled_update_all();
+}
+
+/**
+ * @breif   OLEDλ
+ * @param   page:ҳ 0-7
+ * @param   x: 0-OLED_LIST
+ * @retval  
+ */
+void oled_set_cursor(uint8_t page, uint8_t x)
+{
+    uint8_t cmd[3];
+    cmd[0] = oled_cursor_cmd[0] | page;
+    cmd[1] = oled_cursor_cmd[1] | ((x & 0xF0) >> 4);
+    cmd[2] = oled_cursor_cmd[2] | (x & 0x0F);
+    oled_write_command(cmd, 3);
+}
+
+/**
+ * @breif  ȡOLED
+ * @param   
+ * @retval  
+ */
+void oled_reverse_all(void)
+{
+    oled_fill_area(0, 0, OLED_WIDTH, oled_target_height, 0xFF, 0xFF);
+}
+
+/**
+ * @breif   ȡָ
+ * @param   x: 0-OLED_LIST
+ * @param   y: 0-OLED_HEIGHT
+ * @param   width: 0-OLED_LIST
+ * @param   height:߶ 0-OLED_HEIGHT
+ * @retval  
+ */
+void oled_reverse_area(uint8_t x, uint8_t y, uint8_t width, uint8_t height)
+{
+    oled_fill_area(x, y, x + width, y + height, 0xFF, 0xFF);
+}
+
+/**
+ * @breif  OLED
+ * @param   
+ * @retval  
+ */
+void oled_clear_all(void)
+{
+    oled_fill_area(0, 0, OLED_WIDTH, oled_target_height, 0x00, 0x00);
+}
+
+/**
+ * @breif   ָ
+ * @param   x: 0-OLED_LIST
+ * @param   y: 0-OLED_HEIGHT
+ * @param   width: 0-OLED_LIST
+ * @param   height:߶ 0-OLED_HEIGHT
+ * @retval  
+ */
+void oled_clear_area(uint8_t x, uint8_t y, uint8_t width, uint8_t height)
+{
+    oled_fill_area(x, y, x + width, y + height, 0x00, 0x00);
+}
+
+/**
+ * @breif   ǰ̨ȫ
+ * @param   
+ * @retval  
+ */
+static void oled_flush_spans(void)
+{
+    oled_span_t spans[OLED_PAGES];
+    uint8_t count, i;
+
+    oled_scroll_apply();
+    count = oled_collect_spans(spans);
+    for (i = 0; i < count; i++)
+    {
+        oled_set_window(oled_ram_page(spans[i].page_start), oled_ram_page(spans[i].page_end), spans[i].start,
+                        spans[i].end - 1);
+        oled_write_data(oled_span_data(&spans[i]), oled_span_bytes(&spans[i]));
+    }
+}
+
+/**
+ * @breif   OLEDʾ
+ * @param   
+ * @retval  
+ */
+void oled_update_all(void)
+{
+    uint8_t page;
+
+#if OLED_TRANSPOSE_EN
+    for (page = 0; page < OLED_PAGES; page++) // ֡ת÷
+    {
+        oled_front_dirty_start[page] = 0;
+        oled_front_dirty_end[page] = OLED_LIST;
+    }
+    oled_flush_spans();
+#else
+    oled_scroll_apply();
+    page = OLED_PAGES - oled_scroll_page;                 // ӦGDDRAM0ҳԴҳ
+    oled_set_window(0, OLED_PAGES - 1, 0, OLED_LIST - 1); // Ѱַ֡1024ֽһηͣд7ҳص0ҳ
+    oled_write_data(oled_front_buffer[page % OLED_PAGES], (OLED_PAGES - page % OLED_PAGES) * OLED_LIST);
+    if (page < OLED_PAGES)
+        oled_write_data(oled_front_buffer[0], page * OLED_LIST);
+    for (page = 0; page < OLED_PAGES; page++)
+    {
+        oled_front_dirty_start[page] = 0;
+        oled_front_dirty_end[page] = 0;
+    }
+#endif
+}
+
+/**
+ * @breif   ָ
+ * @param   x: 0-OLED_LIST
+ * @param   y: 0-OLED_HEIGHT
+ * @param   width: 0-OLED_LIST
+ * @param   height:߶ 0-OLED_HEIGHT
+ * @retval  
+ */
+void oled_update_area(uint8_t x, uint8_t y, uint8_t width, uint8_t height)
+{
+    uint8_t i;
+    uint8_t page_end;
+
+    if (width == 0 || height == 0 || x >= OLED_WIDTH || y >= OLED_HEIGHT) // Ļݲʾ
+        return;
+    if (x + width > OLED_WIDTH)
+        width = OLED_WIDTH - x;
+    page_end = (y + height - 1 < OLED_HEIGHT) ? (y + height - 1) / 8 : OLED_PAGES - 1;
+
+#if OLED_TRANSPOSE_EN
+    for (i = y / 8; i <= page_end; i++) // ת÷ͣͬǰ̨һˢ
+    {
+        oled_dirty_merge(oled_front_dirty_start, oled_front_dirty_end, i, x, x + width);
+    }
+    oled_flush_spans();
+#else
+    oled_scroll_apply();
+    i = OLED_PAGES - oled_scroll_page; // ӦGDDRAM0ҳԴҳڲܿ
+    if (oled_scroll_page != 0 && y / 8 < i && i <= page_end)
+    {
+        oled_update_area(x, y, width, i * 8 - y);
+        oled_update_area(x, i * 8, width, (page_end + 1 - i) * 8);
+        return;
+    }
+
+    oled_set_window(oled_ram_page(y / 8), oled_ram_page(page_end), x, x + width - 1); // дһҳԶһҳ
+    if (width == OLED_LIST) // Դһη
+    {
+        oled_write_data(oled_front_buffer[y / 8], (page_end - y / 8 + 1) * OLED_LIST);
+        return;
+    }
+    for (i = y / 8; i <= page_end; i++) // ָҳ
+    {
+        oled_write_data(&oled_front_buffer[i][x], width);
+    }
+#endif
+}
+
+/**
+ * @breif   ֻˢϴˢ仯
+ * @param   
+ * @retval  
+ */
+void oled_flush(void)
+{
+    if (oled_scroll_active) // Ӳڼ䲻дԴ棬ֹͣ
+        return;
+    oled_flush_spans();
+}
+
+/**
+ * @breif   ҳֱʾʼƶ棬ֻ貹¶ҳ
+ * @param   pages:ҳơײ¶ҳơ¶ҳ
+ * @note    Դ֮ƶ¶ҳ㣬ͼʼնӦĻλã
+ *          ˫ʱ´oled_swap_buffersЧЧ
+ * @retval  
+ */
+void oled_scroll_vertical(int8_t pages)
+{
+    uint8_t count, shift, page;
+
+    if (pages == 0)
+        return;
+    count = (pages > 0) ? pages : -pages;
+    if (count > OLED_PAGES)
+        count = OLED_PAGES;
+    shift = (pages > 0) ? count % OLED_PAGES : (OLED_PAGES - count) % OLED_PAGES; // Чҳ
+
+#if OLED_ASYNC_EN && !OLED_DOUBLE_BUFFER_EN
+    oled_async_wait(); // ʱDMAڶȡԴ棬ȴ
+#endif
+    if (pages > 0)
+    {
+        memmove(oled_display_buffer[0], oled_display_buffer[count], (OLED_PAGES - count) * OLED_LIST);
+        memset(oled_display_buffer[OLED_PAGES - count], 0, count * OLED_LIST);
+    }
+    else
+    {
+        memmove(oled_display_buffer[count], oled_display_buffer[0], (OLED_PAGES - count) * OLED_LIST);
+        memset(oled_display_buffer[0], 0, count * OLED_LIST);
+    }
+#if OLED_TRANSPOSE_EN
+    for (page = 0; page < OLED_PAGES; page++) // ʱĻзƶʼ޷ʵ֣֡ط
+    {
+        oled_dirty_merge(oled_dirty_start, oled_dirty_end, page, 0, OLED_LIST);
+    }
+    (void)shift;
+#else
+    oled_dirty_rotate(oled_dirty_start, oled_dirty_end, shift);
+    for (page = 0; page < count; page++) // ¶ҳҳ
+    {
+        oled_dirty_merge(oled_dirty_start, oled_dirty_end, (pages > 0) ? OLED_PAGES - 1 - page : page, 0, OLED_LIST);
+    }
+
+#if OLED_DOUBLE_BUFFER_EN
+    oled_scroll_pending = (oled_scroll_pending + shift) % OLED_PAGES;
+#else
+    if (shift != 0)
+    {
+        uint8_t cmd;
+        oled_scroll_page = (oled_scroll_page + shift) % OLED_PAGES;
+        cmd = 0x40 | (oled_scroll_page * 8); /* ʾʼ */
+        oled_write_command(&cmd, 1);
+    }
+#endif
+#endif
+}
+
+/**
+ * @breif   ӲˮƽԽǹ
+ * @param   cmd:0x26- 0x27- 0x29-ֱ 0x2A-ֱ
+ * @param   page_start:ʼҳ 0-7
+ * @param   page_end:ҳ 0-7
+ * @param   interval:֡ 0-7
+ * @param   offset:ÿֱƫˮƽΪ0
+ * @retval  
+ */
+static void oled_scroll_start(uint8_t cmd, uint8_t page_start, uint8_t page_end, uint8_t interval, uint8_t offset)
+{
+    uint8_t buf[11];
+    uint8_t len = 0;
+
+    page_start = oled_ram_page(page_start);
+    page_end = oled_ram_page(page_end);
+    if (page_start > page_end) // GDDRAM0ҳʱ
     {
-        for (j = 0; j < OLED_LIST; j++)
+        page_start = 0;
+        page_end = OLED_PANEL_PAGES - 1;
+    }
+
+    buf[len++] = 0x2E; /* ޸Ĳǰֹͣ */
+    if (cmd >= 0x29)
+    {
+        buf[len++] = 0xA3; /* ֱΪ */
+        buf[len++] = 0x00;
+        buf[len++] = OLED_PANEL_PAGES * 8;
+    }
+    buf[len++] = cmd;
+    buf[len++] = 0x00;
+    buf[len++] = page_start;
+    buf[len++] = interval & 0x07;
+    buf[len++] = page_end;
+    if (cmd >= 0x29)
+    {
+        buf[len++] = offset & 0x3F;
+    }
+    else
+    {
+        buf[len++] = 0x00;
+        buf[len++] = 0xFF;
+    }
+    oled_write_command(buf, len);
+    buf[0] = 0x2F; /*  */
+    oled_write_command(buf, 1);
+    oled_scroll_active = 1;
+}
+
+/**
+ * @breif   Ӳˮƽڼͣˢ
+ * @param   left:0- 1-
+ * @param   page_start:ʼҳ 0-7
+ * @param   page_end:ҳ 0-7
+ * @param   interval:֡ 0-5֡ 1-64֡ 2-128֡ 3-256֡ 4-3֡ 5-4֡ 6-25֡ 7-2֡
+ * @retval  
+ */
+void oled_scroll_horizontal(uint8_t left, uint8_t page_start, uint8_t page_end, uint8_t interval)
+{
+    oled_scroll_start(left ? 0x27 : 0x26, page_start, page_end, interval, 0);
+}
+
+/**
+ * @breif   ӲԽǹ(ֱָҳˮƽ)ڼͣˢ
+ * @param   left:0- 1-
+ * @param   page_start:ˮƽʼҳ 0-7
+ * @param   page_end:ˮƽҳ 0-7
+ * @param   interval:֡ͬoled_scroll_horizontal
+ * @param   offset:ÿֱ 1-63
+ * @retval  
+ */
+void oled_scroll_diagonal(uint8_t left, uint8_t page_start, uint8_t page_end, uint8_t interval, uint8_t offset)
+{
+    oled_scroll_start(left ? 0x2A : 0x29, page_start, page_end, interval, offset);
+}
+
+/**
+ * @breif   ֹͣӲˮƽ/Խǹָʼвд֡
+ * @note    дGDDRAMֹͣ·Դ
+ * @param   
+ * @retval  
+ */
+void oled_scroll_stop(void)
+{
+    uint8_t cmd[2];
+
+    cmd[0] = 0x2E;                           /* ֹͣ */
+    cmd[1] = 0x40 | (oled_scroll_page * 8); /* ԽǹıʼУָ */
+    oled_write_command(cmd, 2);
+    oled_scroll_active = 0;
+    oled_update_all();
+}
+
+#if OLED_DOUBLE_BUFFER_EN
+
+/**
+ * @breif   ǰ̨岢֪ͨʾˢ
+ * @param   
+ * @retval  
+ */
+void oled_swap_buffers(void)
+{
+    uint8_t (*temp)[OLED_LIST];
+    uint8_t copy_start[OLED_PAGES];
+    uint8_t copy_end[OLED_PAGES];
+    uint8_t page, scroll;
+
+    for (;;) // ǰ̨ڷʱܽ˺
+    {
+        taskENTER_CRITICAL();
+        if (!oled_front_busy)
+            break;
+        taskEXIT_CRITICAL();
+        vTaskDelay(1);
+    }
+    temp = oled_front_buffer;
+    oled_front_buffer = oled_display_buffer;
+    oled_display_buffer = temp;
+    scroll = oled_scroll_pending;
+    if (scroll != 0) // ǰ̨δ͵Ҳ滭
+    {
+        oled_dirty_rotate(oled_front_dirty_start, oled_front_dirty_end, scroll);
+        oled_front_scroll = (oled_front_scroll + scroll) % OLED_PAGES;
+        oled_scroll_pending = 0;
+    }
+    for (page = 0; page < OLED_PAGES; page++) // ֡תΪǰ̨
+    {
+        copy_start[page] = oled_dirty_start[page];
+        copy_end[page] = oled_dirty_end[page];
+        if (copy_start[page] < copy_end[page])
+            oled_dirty_merge(oled_front_dirty_start, oled_front_dirty_end, page, copy_start[page], copy_end[page]);
+        oled_dirty_start[page] = 0;
+        oled_dirty_end[page] = 0;
+    }
+    taskEXIT_CRITICAL();
+
+    /* º̨һֻ֡貹ϱ֡Ķмǰ̨һ£ͼɼУ֡ */
+    if (scroll != 0)
+        memcpy(oled_display_buffer[0], oled_front_buffer[0], OLED_PAGES * OLED_LIST);
+    for (page = 0; scroll == 0 && page < OLED_PAGES; page++)
+    {
+        if (copy_start[page] < copy_end[page])
         {
-            oled_display_buffer[i][j] = (i % 2 == 0) ? 0xAA : 0x55;
+            memcpy(&oled_display_buffer[page][copy_start[page]], &oled_front_buffer[page][copy_start[page]],
+                   copy_end[page] - copy_start[page]);
         }
     }
-    oled_update_all();  // ǿˢʾ
+
+    if (oled_display_task_handle != NULL)
+        xTaskNotifyGive(oled_display_task_handle);
 }
+
 /**
- * @breif   ʼOLED
+ * @breif   ʾ񣬶ռߣյ֪ͨˢǰ̨
+ * @param   argument:δʹ
+ * @retval  
+ */
+void oled_display_task(void *argument)
+{
+    (void)argument;
+    oled_display_task_handle = xTaskGetCurrentTaskHandle();
+
+    for (;;)
+    {
+        taskENTER_CRITICAL(); // oled_swap_buffers⣬λǰ̨岻ᱻ
+        oled_front_busy = 1;
+        taskEXIT_CRITICAL();
+#if OLED_ASYNC_EN
+        oled_flush_async(oled_display_task_handle);
+        do // ȴDMAɣǰĽ֪ͨȻѣٴȷ
+        {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        } while (oled_flush_busy());
+#else
+        oled_flush();
+#endif
+        oled_front_busy = 0;
+
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY); // ȴһν
+    }
+}
+
+#endif
+
+#if OLED_FRAME_LOCK_EN
+
+/**
+ * @breif   ʼһ֡ȡ֡
  * @param   
  * @retval  
  */
-void oled_init(void)
+void oled_frame_begin(void)
 {
-	
-    OLED_INIT_FUNS();
-    OLED_WRITE_COMMAND((uint8_t *)oled_init_cmd, sizeof(oled_init_cmd) / sizeof(oled_init_cmd[0]));
-    oled_clear_all();
-    oled_update_all();
+    if (oled_frame_mutex != NULL && xTaskGetSchedulerState() == taskSCHEDULER_RUNNING) // ǰֻһִ
+        xSemaphoreTakeRecursive(oled_frame_mutex, portMAX_DELAY);
 }
 
 /**
- * @breif   OLEDλ
- * @param   page:ҳ 0-7
- * @param   x: 0-OLED_LIST
+ * @breif   һ֡ͷ֡
+ * @param   
  * @retval  
  */
-void oled_set_cursor(uint8_t page, uint8_t x)
+void oled_frame_end(void)
 {
-    uint8_t cmd[3];
-    cmd[0] = oled_cursor_cmd[0] | page;
-    cmd[1] = oled_cursor_cmd[1] | ((x & 0xF0) >> 4);
-    cmd[2] = oled_cursor_cmd[2] | (x & 0x0F);
-    OLED_WRITE_COMMAND(cmd, 3);
+    if (oled_frame_mutex != NULL && xTaskGetSchedulerState() == taskSCHEDULER_RUNNING)
+        xSemaphoreGiveRecursive(oled_frame_mutex);
 }
 
+#endif
+
+#if OLED_ASYNC_EN || OLED_DOUBLE_BUFFER_EN
+
 /**
- * @breif  ȡOLED
+ * @breif   ȴ߿У첽ˢѽ˫ʱʾѷǰ̨
  * @param   
  * @retval  
  */
-void oled_reverse_all(void)
+void oled_wait_idle(void)
 {
-    uint8_t i, j;
-    for (i = 0; i < OLED_PAGES; i++)
+#if OLED_DOUBLE_BUFFER_EN
+    uint8_t page, busy;
+
+    while (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING) // ǰʾδ
     {
-        for (j = 0; j < OLED_LIST; j++)
-        {
-            oled_display_buffer[i][j] ^= 0xFF;
-        }
+        taskENTER_CRITICAL(); // ѽʾûʼʱǰ̨Ϊ
+        busy = oled_front_busy;
+        for (page = 0; page < OLED_PAGES && !oled_scroll_active; page++)
+            busy |= (oled_front_dirty_start[page] < oled_front_dirty_end[page]);
+        taskEXIT_CRITICAL();
+        if (!busy)
+            break;
+        vTaskDelay(1);
     }
+#endif
+#if OLED_ASYNC_EN
+    oled_async_wait();
+#endif
 }
 
+#endif
+
+#if OLED_GOVERNOR_EN
+
 /**
- * @breif   ȡָ
+ * @breif   ˢָ򣬶ϲoled_update_task֡ͳһˢ
  * @param   x: 0-OLED_LIST
  * @param   y: 0-OLED_HEIGHT
  * @param   width: 0-OLED_LIST
  * @param   height:߶ 0-OLED_HEIGHT
+ * @note    ȼںϲˢԼļ¼УֱӸдͼд
  * @retval  
  */
-void oled_reverse_area(uint8_t x, uint8_t y, uint8_t width, uint8_t height)
+void oled_request_update(uint8_t x, uint8_t y, uint8_t width, uint8_t height)
 {
-    uint8_t i, j;
+    uint8_t page;
+    uint16_t x_end = (uint16_t)x + width;
+    uint16_t y_end = (uint16_t)y + height;
+
+    if (x_end > OLED_WIDTH)
+        x_end = OLED_WIDTH;
+    if (y_end > OLED_HEIGHT)
+        y_end = OLED_HEIGHT;
+
+    taskENTER_CRITICAL();
+    if (x < x_end && y < y_end) // 0߻򳬳Ļֻˢ
+    {
+        for (page = y / 8; page <= (y_end - 1) / 8; page++)
+            oled_dirty_merge(oled_update_start, oled_update_end, page, x, x_end);
+    }
+    if (!oled_update_pending)
+    {
+        oled_update_pending = 1;
+        oled_update_first = xTaskGetTickCount();
+    }
+    oled_update_stats.requests++;
+    taskEXIT_CRITICAL();
+
+    if (oled_update_task_handle != NULL)
+        xTaskNotifyGive(oled_update_task_handle);
+}
+
+/**
+ * @breif   ϲˢڣMX_FREERTOS_Initдˢ¼С1/OLED_MAX_FPS
+ * @param   argument:δʹ
+ * @retval  
+ */
+void oled_update_task(void *argument)
+{
+    const TickType_t period = pdMS_TO_TICKS(1000 / OLED_MAX_FPS);
+    TickType_t last = xTaskGetTickCount() - period;
+    TickType_t now, latency;
+    uint32_t bytes = oled_tx_bytes;
+    uint8_t page;
 
-    for (i = y; i < y + height; i++) // ָҳ
+    (void)argument;
+    oled_update_task_handle = xTaskGetCurrentTaskHandle();
+
+    for (;;)
     {
-        for (j = x; j < x + width; j++) // ָ
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY); // ȴ
+        now = xTaskGetTickCount();
+        if (now - last < period) // ϴˢ²һ֡ȴڼһϲ
+            vTaskDelay(period - (now - last));
+
+        taskENTER_CRITICAL();
+        last = xTaskGetTickCount();
+        latency = last - oled_update_first;
+        oled_update_pending = 0;
+        taskEXIT_CRITICAL();
+
+        oled_frame_begin(); // Ȼͼ굱ǰ֡Ͱ֡
+        taskENTER_CRITICAL(); // ֡ʱûлͼڸ
+        for (page = 0; page < OLED_PAGES; page++)
         {
-            if (i < OLED_HEIGHT && j < OLED_WIDTH) // Ļݲʾ
-            {
-                oled_display_buffer[i / OLED_PAGES][j] ^= ~(0x01 << (i % 8)); // Դָ
-            }
+            if (oled_update_start[page] < oled_update_end[page])
+                oled_dirty_merge(oled_dirty_start, oled_dirty_end, page, oled_update_start[page], oled_update_end[page]);
+            oled_update_start[page] = oled_update_end[page] = 0;
         }
+        taskEXIT_CRITICAL();
+#if OLED_DOUBLE_BUFFER_EN
+        oled_swap_buffers(); // ʾֽͣͺһ֡
+#elif OLED_ASYNC_EN
+        oled_flush_async(oled_update_task_handle);
+        do // ʱDMAֱӶԴ棬ͼ
+        {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        } while (oled_flush_busy());
+        if (oled_update_pending) // ȴڼ䵽֪ͨѱȡߣ
+            xTaskNotifyGive(oled_update_task_handle);
+#else
+        oled_flush();
+#endif
+        oled_frame_end();
+
+        taskENTER_CRITICAL();
+        oled_update_stats.flushes++;
+        oled_update_stats.bytes += oled_tx_bytes - bytes; // ϴͳ͵ֽ
+        bytes = oled_tx_bytes;
+        if (latency > oled_update_stats.latency_max)
+            oled_update_stats.latency_max = latency;
+        taskEXIT_CRITICAL();
     }
 }
 
 /**
- * @breif  OLED
+ * @breif   ȡϲˢͳ
+ * @param   stats:ͳ
+ * @retval  
+ */
+void oled_get_update_stats(oled_update_stats_t *stats)
+{
+    taskENTER_CRITICAL();
+    *stats = oled_update_stats;
+    taskEXIT_CRITICAL();
+}
+
+/**
+ * @breif   ϲˢͳ
  * @param   
  * @retval  
  */
-void oled_clear_all(void)
+void oled_clear_update_stats(void)
 {
-    uint8_t i, j;
-    for (i = 0; i < OLED_PAGES; i++)
+    taskENTER_CRITICAL();
+    memset(&oled_update_stats, 0, sizeof(oled_update_stats));
+    taskEXIT_CRITICAL();
+}
+
+#endif
+
+#if OLED_ASYNC_EN
+
+/**
+ * @breif   첽ˢ²֪ͨ
+ * @param   error:0-ɹ 1-ߴ
+ * @param   from_isr:0-е 1-же
+ * @retval  
+ */
+static void oled_async_finish(uint8_t error, uint8_t from_isr)
+{
+    BaseType_t woken = pdFALSE;
+
+    if (error) // δͳɹ´ռʱ±
+        oled_async_retry = (oled_async_step - 1) / 2;
+    oled_async_busy = 0;
+    oled_flush_cplt_callback(error);
+    if (oled_async_idle != NULL) // ѵȴߵ
     {
-        for (j = 0; j < OLED_LIST; j++)
-        {
-            oled_display_buffer[i][j] = 0x00;
-        }
+        if (from_isr)
+            xSemaphoreGiveFromISR(oled_async_idle, &woken);
+        else
+            xSemaphoreGive(oled_async_idle);
     }
+
+    if (oled_async_notify != NULL)
+    {
+        if (from_isr)
+            vTaskNotifyGiveFromISR(oled_async_notify, &woken);
+        else
+            xTaskNotifyGive(oled_async_notify);
+    }
+    if (from_isr)
+        portYIELD_FROM_ISR(woken);
 }
 
 /**
- * @breif   ָ
- * @param   x: 0-OLED_LIST
- * @param   y: 0-OLED_HEIGHT
- * @param   width: 0-OLED_LIST
- * @param   height:߶ 0-OLED_HEIGHT
+ * @breif   첽ˢµһDMA
+ * @param   from_isr:0-е 1-же
  * @retval  
  */
-void oled_clear_area(uint8_t x, uint8_t y, uint8_t width, uint8_t height)
+static void oled_async_next(uint8_t from_isr)
 {
-    uint8_t i, j;
+    oled_span_t *span;
+    uint8_t *data;
+    uint16_t len;
+    uint8_t dc;
 
-    for (i = y; i < y + height; i++) // ָҳ
+    do
     {
-        for (j = x; j < x + width; j++) // ָ
+        if (oled_async_step >= oled_async_count * 2) // ȫ
         {
-            if (i < OLED_HEIGHT && j < OLED_WIDTH) // Ļݲʾ
-            {
-                oled_display_buffer[i / OLED_PAGES][j] &= ~(0x01 << (i % 8)); // Դָ
-            }
+            oled_async_finish(0, from_isr);
+            return;
         }
-    }
+
+        span = &oled_async_span[oled_async_step / 2];
+        dc = oled_async_step % 2;
+        if (dc == 0) // ô
+        {
+            oled_async_cmd[0] = 0x21;
+            oled_async_cmd[1] = span->start;
+            oled_async_cmd[2] = span->end - 1;
+            oled_async_cmd[3] = 0x22;
+            oled_async_cmd[4] = oled_ram_page(span->page_start);
+            oled_async_cmd[5] = oled_ram_page(span->page_end);
+            data = oled_async_cmd;
+            len = 6;
+        }
+        else // Դ
+        {
+            data = oled_span_data(span);
+            len = oled_span_bytes(span);
+        }
+        oled_async_step++;
+        oled_tx_bytes += len + oled_transport->overhead;
+
+        if (oled_transport->write_dma == NULL) // ֧DMAʱͣŷһ
+        {
+            oled_transport->write(dc, data, len);
+        }
+        else if (oled_transport->write_dma(dc, data, len))
+        {
+            oled_async_finish(1, from_isr);
+            return;
+        }
+    } while (oled_transport->write_dma == NULL);
 }
 
 /**
- * @breif   OLEDʾ
+ * @breif   DMA첽ˢ
+ * @param   notify_task:ȫɺ֪ͨNULL֪ͨ
+ * @retval  0-(ʱֱ֪ͨ) 1-һˢδ
+ */
+uint8_t oled_flush_async(TaskHandle_t notify_task)
+{
+    if (oled_async_busy)
+        return 1;
+
+    oled_scroll_apply();
+    oled_async_count = oled_scroll_active ? 0 : oled_collect_spans(oled_async_span); // ȡߵǰ֮Ļͼ¼¼
+    oled_async_retry = oled_async_count;
+    oled_async_step = 0;
+    oled_async_notify = notify_task;
+    oled_async_busy = 1;
+    oled_async_next(0);
+    return 0;
+}
+
+/**
+ * @breif   ѯ첽ˢǷ
  * @param   
+ * @retval  0- 1-
+ */
+uint8_t oled_flush_busy(void)
+{
+    return oled_async_busy;
+}
+
+/**
+ * @breif   첽ˢɻص壬ûд
+ * @param   error:0-ɹ 1-ߴ
  * @retval  
  */
-void oled_update_all(void)
+__weak void oled_flush_cplt_callback(uint8_t error)
 {
-    uint8_t i;
-    for (i = 0; i < OLED_PAGES; i++)
+    (void)error;
+}
+
+#if OLED_I2C_EN
+/**
+ * @breif   I2Cڴджϻصƽ첽ˢ
+ * @param   hi2c:I2C
+ * @retval  
+ */
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+    if (hi2c == &OLED_I2C_HANDLE && oled_async_busy)
     {
-        oled_set_cursor(i, 0);
-        OLED_WRITE_DATA(oled_display_buffer[i], OLED_LIST);
+        oled_async_next(1);
     }
 }
 
 /**
- * @breif   ָ
+ * @breif   I2Cжϻصֹ첽ˢ
+ * @param   hi2c:I2C
+ * @retval  
+ */
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+    if (hi2c == &OLED_I2C_HANDLE && oled_async_busy)
+    {
+        oled_async_finish(1, 1);
+    }
+}
+#endif
+
+#if OLED_SPI_EN
+/**
+ * @breif   SPIжϻصͷƬѡƽ첽ˢ
+ * @param   hspi:SPI
+ * @retval  
+ */
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+    if (hspi == &OLED_SPI_HANDLE && oled_async_busy)
+    {
+        HAL_GPIO_WritePin(OLED_CS_PORT, OLED_CS_PIN, GPIO_PIN_SET);
+        oled_async_next(1);
+    }
+}
+
+/**
+ * @breif   SPIжϻصͷƬѡֹ첽ˢ
+ * @param   hspi:SPI
+ * @retval  
+ */
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
+{
+    if (hspi == &OLED_SPI_HANDLE && oled_async_busy)
+    {
+        HAL_GPIO_WritePin(OLED_CS_PORT, OLED_CS_PIN, GPIO_PIN_SET);
+        oled_async_finish(1, 1);
+    }
+}
+#endif
+
+#endif
+
+/**
+ * @breif   ȡۼƷ͵OLEDֽ
+ * @param   
+ * @retval  ֽ(ֽڣI2Cַ)
+ */
+uint32_t oled_get_tx_bytes(void)
+{
+    return oled_tx_bytes;
+}
+
+/**
+ * @breif   㷢ֽڼ
+ * @param   
+ * @retval  
+ */
+void oled_clear_tx_bytes(void)
+{
+    oled_tx_bytes = 0;
+}
+
+/**
+ * @breif   ʾͼ
  * @param   x: 0-OLED_LIST
  * @param   y: 0-OLED_HEIGHT
+ * @param   image:ͼ
  * @param   width: 0-OLED_LIST
  * @param   height:߶ 0-OLED_HEIGHT
  * @retval  
  */
-void oled_update_area(uint8_t x, uint8_t y, uint8_t width, uint8_t height)
+void oled_show_image(uint8_t x, uint8_t y, const uint8_t *image, uint8_t width, uint8_t height)
 {
-    uint8_t i;
+    oled_blit(x, y, image, width, height);
+}
 
-    for (i = y / OLED_PAGES; i < (y + height - 1) / OLED_PAGES + 1; i++) // ָҳ
-    {
-        if (i < OLED_HEIGHT && x < OLED_WIDTH) // Ļݲʾ
-        {
-            oled_set_cursor(i, x);
-            OLED_WRITE_DATA(&oled_display_buffer[i][x], width);
-        }
-    }
+/**
+ * @breif   ʾRLEѹͼ񣬱߽дԴ
+ * @param   x: 0-OLED_LIST
+ * @param   y: 0-OLED_HEIGHT
+ * @param   data:ѹݣTools/oled_imgc.py --compress rle
+ * @param   width: 0-OLED_LIST
+ * @param   height:߶ 0-OLED_HEIGHT
+ * @retval  
+ */
+void oled_show_image_rle(uint8_t x, uint8_t y, const uint8_t *data, uint8_t width, uint8_t height)
+{
+    if (width == 0 || height == 0)
+        return;
+    oled_blit_rle(x, y, data, width, height);
 }
 
 /**
- * @breif   ʾͼ
+ * @breif   ʾλŵͼ񣬱߽дԴ
  * @param   x: 0-OLED_LIST
  * @param   y: 0-OLED_HEIGHT
- * @param   image:ͼ
+ * @param   data:УÿheightλTools/oled_imgc.py --compress packed
  * @param   width: 0-OLED_LIST
  * @param   height:߶ 0-OLED_HEIGHT
  * @retval  
  */
-void oled_show_image(uint8_t x, uint8_t y, const uint8_t *image, uint8_t width, uint8_t height)
+void oled_show_image_packed(uint8_t x, uint8_t y, const uint8_t *data, uint8_t width, uint8_t height)
 {
-    uint8_t i, j;
-    uint8_t page, shift;
-
-    oled_clear_area(x, y, width, height);
-    for (i = 0; i < (height - 1) / OLED_PAGES + 1; i++)
-    {
-        for (j = 0; j < width; j++)
-        {
-            if (x + j < OLED_WIDTH)
-            {
-                page = y / OLED_PAGES;
-                shift = y % OLED_PAGES;
-
-                if (page + i < OLED_PAGES)
-                {
-                    oled_display_buffer[page + i][x + j] |= image[i * width + j] << (shift);
-                }
-
-                if (page + i + 1 < OLED_PAGES)
-                {
-                    oled_display_buffer[page + i + 1][x + j] |= image[i * width + j] >> (OLED_PAGES - shift);
-                }
-            }
-        }
-    }
+    if (width == 0 || height == 0)
+        return;
+    oled_blit_packed(x, y, data, width, height);
 }
 
 /**
@@ -233,6 +2285,39 @@ void oled_show_char(uint8_t x, uint8_t y, uint8_t ch, uint8_t font_size)
     }
 }
 
+/**
+ * @breif   ʾһASCIIַGBK
+ * @param   x: 0-OLED_LIST
+ * @param   y: 0-OLED_HEIGHT
+ * @param   code:ASCII˫ֽGBK
+ * @param   font_size:С
+ * @retval  ֿ
+ */
+static uint8_t oled_show_code(uint8_t x, uint8_t y, uint16_t code, uint8_t font_size)
+{
+    const OLED_Character_t *pchar;
+
+    if (code < 0x80)
+    {
+        oled_show_char(x, y, code, font_size);
+        return font_size;
+    }
+    if (font_size == OLED_FONT_7X12)
+    {
+        pchar = oled_find_cjk(oled_Cfont_12x12, oled_Cfont_12x12_count, code);
+        oled_show_image(x, y, pchar->Data, 12, 12);
+        return 12;
+    }
+    if (font_size == OLED_FONT_8X16)
+    {
+        pchar = oled_find_cjk(oled_Cfont_16x16, oled_Cfont_16x16_count, code);
+        oled_show_image(x, y, pchar->Data, 16, 16);
+        return 16;
+    }
+    oled_show_char(x, y, '?', font_size); // ֺûкֿ⣬ʺռλ
+    return font_size;
+}
+
 /**
  * @breif   ʾַGBK
  * @param   x: 0-OLED_LIST
@@ -243,61 +2328,77 @@ void oled_show_char(uint8_t x, uint8_t y, uint8_t ch, uint8_t font_size)
  */
 void oled_show_string(uint8_t x, uint8_t y, uint8_t *str, uint8_t font_size)
 {
-    uint8_t char_len = 0;
-    char temp_char[5];
-    uint16_t index;
-    uint8_t width;
-    uint8_t height;
+    uint16_t code;
 
     while (*str != '\0')
     {
-        if ((*str & 0x80) == 0x00)
-        {
-            char_len = 1;
-            temp_char[0] = *str++;
-            temp_char[1] = '\0';
-        }
-        else // λΪ1
+        code = *str++;
+        if (code & 0x80) // λΪ1˫ַֽ
         {
-            char_len = 2;
-            temp_char[0] = *str++;
             if (*str == '\0')
                 break;
-            temp_char[1] = *str++;
-            temp_char[2] = '\0';
+            code = (code << 8) | *str++;
         }
+        x += oled_show_code(x, y, code, font_size);
+    }
+}
 
-        if (char_len == 1) // ǵַֽ
-        {
-            oled_show_char(x, y, temp_char[0], font_size);
-            x += font_size;
-        }
-        else // ˫ַֽ
+/**
+ * @breif   ñɵֿʾַ֧ASCIIGBKֻţֿֿ
+ * @param   x: 0-OLED_LIST
+ * @param   y: 0-OLED_HEIGHT
+ * @param   str:ַ
+ * @param   font:ֿ
+ * @retval  
+ */
+void oled_show_text(uint8_t x, uint8_t y, const uint8_t *str, const oled_font_t *font)
+{
+    uint16_t code, index;
+
+    while (*str != '\0' && x < OLED_WIDTH)
+    {
+        code = *str++;
+        if (code & 0x80) // ˫ַֽ
         {
-            const OLED_Character_t *pchar = NULL;
-            if (font_size == OLED_FONT_7X12)
-            {
-                pchar = oled_Cfont_12x12;
-                width = 12;
-                height = 12;
-            }
-            else if (font_size == OLED_FONT_8X16)
-            {
-                pchar = oled_Cfont_16x16;
-                width = 16;
-                height = 16;
-            }
-            for (index = 0; strcmp((const char *)pchar[index].Index, "") != 0; index++)
-            {
-                if (strcmp((const char *)pchar[index].Index, temp_char) == 0)
-                {
-                    break;
-                }
-            }
-            oled_show_image(x, y, pchar[index].Data, width, height);
-            x += width;
+            if (*str == '\0')
+                break;
+            code = (code << 8) | *str++;
         }
+        index = oled_font_find(font, code);
+        if (font->format == OLED_FORMAT_RLE)
+            oled_show_image_rle(x, y, &font->bitmap[font->offset[index]], font->width[index], font->height);
+        else if (font->format == OLED_FORMAT_PACKED)
+            oled_show_image_packed(x, y, &font->bitmap[font->offset[index]], font->width[index], font->height);
+        else
+            oled_show_image(x, y, &font->bitmap[font->offset[index]], font->width[index], font->height);
+        x += font->width[index];
+    }
+}
+
+/**
+ * @breif   ʽصֱַӻĻ
+ * @param   arg:oled_text_sink_t
+ * @param   ch:ַGBKַδ
+ * @retval  
+ */
+static void oled_text_putc(void *arg, char ch)
+{
+    oled_text_sink_t *sink = (oled_text_sink_t *)arg;
+    uint16_t code = (uint8_t)ch;
+
+    if (sink->lead != 0) // ֵڶֽ
+    {
+        code |= sink->lead << 8;
+        sink->lead = 0;
+    }
+    else if (code & 0x80) // ֵһֽڣһֽ
+    {
+        sink->lead = code;
+        return;
     }
+    if (sink->x >= OLED_WIDTH) // Ļַ
+        return;
+    sink->x += oled_show_code(sink->x, sink->y, code, sink->font_size);
 }
 
 /**
@@ -305,17 +2406,17 @@ void oled_show_string(uint8_t x, uint8_t y, uint8_t *str, uint8_t font_size)
  * @param   x: 0-OLED_LIST
  * @param   y: 0-OLED_HEIGHT
  * @param   font_size:С
- * @param   fmt:ʽַ
+ * @param   fmt:ʽַʽoled_vformat
+ * @note    ߸ʽʾ壬ȲƣĻַ
  * @retval  
  */
 void oled_printf(uint8_t x, uint8_t y, uint8_t font_size, const char *fmt, ...)
 {
-    char str[64];
+    oled_text_sink_t sink = {x, y, font_size, 0};
     va_list args;
     va_start(args, fmt);
-    vsnprintf(str, sizeof(str), fmt, args);
+    oled_vformat(oled_text_putc, &sink, fmt, args);
     va_end(args);
-    oled_show_string(x, y, (uint8_t *)str, font_size);
 }
 
 /**
@@ -326,9 +2427,13 @@ void oled_printf(uint8_t x, uint8_t y, uint8_t font_size, const char *fmt, ...)
  */
 void oled_draw_point(uint8_t x, uint8_t y)
 {
-    if (x < OLED_WIDTH && y < OLED_HEIGHT)
+    uint8_t *row;
+
+    if (x >= oled_ctx.clip_x && x < oled_ctx.clip_x_end && y >= oled_ctx.clip_y && y < oled_ctx.clip_y_end)
     {
-        oled_display_buffer[y / OLED_PAGES][x] |= (0x01 << (y % 8));
+        row = oled_target_page(y / 8);
+        row[x] = oled_rop_byte(row[x], 0xFF, 0x01 << (y % 8));
+        oled_mark_dirty(x, y, 1, 1);
     }
 }
 
@@ -342,118 +2447,447 @@ void oled_draw_point(uint8_t x, uint8_t y)
  */
 void oled_draw_rectangle(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t fill)
 {
-    uint8_t i, j;
+    if (width == 0 || height == 0)
+        return;
     if (fill)
     {
-        for (i = x; i < x + width; i++)
+        oled_fill_rect(x, y, x + width, y + height);
+    }
+    else // ߻صXORʱǵ㲻ᱻ
+    {
+        oled_fill_rect(x, y, x + width, y + 1);
+        if (height > 1)
+            oled_fill_rect(x, y + height - 1, x + width, y + height);
+        if (height > 2)
         {
-            for (j = y; j < y + height; j++)
-            {
-                oled_draw_point(i, j);
-            }
+            oled_fill_rect(x, y + 1, x + 1, y + height - 1);
+            if (width > 1)
+                oled_fill_rect(x + width - 1, y + 1, x + width, y + height - 1);
         }
     }
+}
+
+/**
+ * @breif   ֱ
+ * @param   x0:УɳĻ
+ * @param   y0:
+ * @param   x1:յ
+ * @param   y1:յ
+ * @retval  
+ */
+void oled_draw_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+    if (y0 == y1) // ˮƽ봹ֱ߰
+    {
+        oled_draw_hline((x0 < x1) ? x0 : x1, y0, ((x0 < x1) ? x1 - x0 : x0 - x1) + 1);
+    }
+    else if (x0 == x1)
+    {
+        oled_draw_vline(x0, (y0 < y1) ? y0 : y1, ((y0 < y1) ? y1 - y0 : y0 - y1) + 1);
+    }
     else
     {
-        for (i = x; i < x + width; i++)
+        oled_line(x0, y0, x1, y1, 1);
+    }
+}
+
+/**
+ * @breif   ˮƽ
+ * @param   x:ʼУΪ
+ * @param   y:
+ * @param   width:
+ * @retval  
+ */
+void oled_draw_hline(int16_t x, int16_t y, int16_t width)
+{
+    oled_fill_rect(x, y, x + width, y + 1);
+}
+
+/**
+ * @breif   ƴֱߣÿҳֻдһֽ
+ * @param   x:
+ * @param   y:ʼУΪ
+ * @param   height:
+ * @retval  
+ */
+void oled_draw_vline(int16_t x, int16_t y, int16_t height)
+{
+    oled_fill_rect(x, y, x + 1, y + height);
+}
+
+/**
+ * @breif   Բ
+ * @param   x:ԲУɳĻ
+ * @param   y:Բ
+ * @param   radius:뾶 0-127
+ * @param   fill:Ƿ 0- 1-
+ * @retval  
+ */
+void oled_draw_circle(int16_t x, int16_t y, uint8_t radius, uint8_t fill)
+{
+    oled_ellipse(x, y, radius, radius, fill, NULL);
+}
+
+/**
+ * @breif   Բ
+ * @param   x:ԲУɳĻ
+ * @param   y:Բ
+ * @param   rx:ˮƽ뾶 0-127
+ * @param   ry:ֱ뾶 0-127
+ * @param   fill:Ƿ 0- 1-
+ * @retval  
+ */
+void oled_draw_ellipse(int16_t x, int16_t y, uint8_t rx, uint8_t ry, uint8_t fill)
+{
+    oled_ellipse(x, y, rx, ry, fill, NULL);
+}
+
+/**
+ * @breif   Բ
+ * @param   x:ԲУɳĻ
+ * @param   y:Բ
+ * @param   radius:뾶 0-127
+ * @param   start_angle:ʼǣλȣ0ָҷʱΪ
+ * @param   end_angle:ǣʼʱתǣ360ȼʱΪԲ
+ * @retval  
+ */
+void oled_draw_arc(int16_t x, int16_t y, uint8_t radius, int16_t start_angle, int16_t end_angle)
+{
+    oled_arc_t arc;
+    int16_t sweep = end_angle - start_angle;
+
+    if (sweep >= 360 || sweep <= -360)
+    {
+        oled_ellipse(x, y, radius, radius, 0, NULL);
+        return;
+    }
+    sweep = (sweep + 360) % 360;
+    arc.start_x = oled_sin(start_angle + 90);
+    arc.start_y = oled_sin(start_angle);
+    arc.end_x = oled_sin(end_angle + 90);
+    arc.end_y = oled_sin(end_angle);
+    arc.wide = sweep > 180;
+    oled_ellipse(x, y, radius, radius, 0, &arc);
+}
+
+/**
+ * @breif   ƶβԶպ
+ * @param   points:
+ * @param   count:
+ * @retval  
+ */
+void oled_draw_polygon(const oled_point_t *points, uint8_t count)
+{
+    uint8_t i;
+
+    if (count == 1)
+    {
+        oled_line(points[0].x, points[0].y, points[0].x, points[0].y, 1);
+        return;
+    }
+    for (i = 0; i < count; i++) // ÿ߲յ㣬ֻдһ
+    {
+        oled_line(points[i].x, points[i].y, points[(i + 1) % count].x, points[(i + 1) % count].y, 0);
+    }
+}
+
+/**
+ * @breif   Σɨ裬ÿеڲΰҳ
+ * @param   points:
+ * @param   count: 3-OLED_POLYGON_MAX
+ * @note    żһ£ұ±߲
+ *          (0,0)(10,0)(10,10)(0,10)oled_draw_rectangle(0,0,10,10,1)ͬ
+ * @retval  
+ */
+void oled_fill_polygon(const oled_point_t *points, uint8_t count)
+{
+    int16_t cross[OLED_POLYGON_MAX];
+    int16_t x, x_min, x_max, t;
+    int16_t ax, ay, bx, by;
+    int32_t num, den;
+    uint8_t i, j, n;
+
+    if (count < 3 || count > OLED_POLYGON_MAX)
+        return;
+
+    x_min = x_max = points[0].x;
+    for (i = 1; i < count; i++)
+    {
+        if (points[i].x < x_min)
+            x_min = points[i].x;
+        if (points[i].x > x_max)
+            x_max = points[i].x;
+    }
+    if (x_min < oled_ctx.clip_x)
+        x_min = oled_ctx.clip_x;
+    if (x_max > oled_ctx.clip_x_end)
+        x_max = oled_ctx.clip_x_end;
+
+    for (x = x_min; x < x_max; x++)
+    {
+        n = 0;
+        for (i = 0; i < count; i++) // 뱾еĽ
         {
-            oled_draw_point(i, y);
-            oled_draw_point(i, y + height - 1);
+            ax = points[i].x;
+            ay = points[i].y;
+            bx = points[(i + 1) % count].x;
+            by = points[(i + 1) % count].y;
+            if ((ax <= x && x < bx) || (bx <= x && x < ax))
+            {
+                /* ȡx+0.5뵽 */
+                num = (int32_t)(2 * (x - ax) + 1) * (by - ay);
+                den = 2 * (bx - ax);
+                if (den < 0)
+                {
+                    num = -num;
+                    den = -den;
+                }
+                num = 2 * num + den;
+                den *= 2;
+                t = ay + (int16_t)((num >= 0) ? num / den : -((den - 1 - num) / den));
+                for (j = n; j > 0 && cross[j - 1] > t; j--) // 
+                    cross[j] = cross[j - 1];
+                cross[j] = t;
+                n++;
+            }
         }
-        for (i = y; i < y + height; i++)
+        for (i = 0; i + 1 < n; i += 2)
         {
-            oled_draw_point(x, i);
-            oled_draw_point(x + width - 1, i);
+            oled_fill_rect(x, cross[i], x + 1, cross[i + 1]);
         }
     }
 }
 
-#if OLED_FONT_GBK_EN
+/**
+ * @breif   ùդ
+ * @param   rop:դ OLED_ROP_COPY/OR/AND/XOR/ANDNOT
+ * @retval  
+ */
+void oled_set_rop(oled_rop_t rop)
+{
+    if (rop <= OLED_ROP_ANDNOT)
+        oled_ctx.rop = rop;
+}
 
 /**
- * @breif   ʾַ
+ * @breif   ͼĿķΧòü
+ * @param   x:ʼ
+ * @param   y:ʼ
+ * @param   x_end:()
+ * @param   y_end:()
+ * @retval  
+ */
+static void oled_clip_set(uint16_t x, uint16_t y, uint16_t x_end, uint16_t y_end)
+{
+    oled_ctx.clip_x = (x < OLED_WIDTH) ? x : OLED_WIDTH;
+    oled_ctx.clip_y = (y < oled_target_height) ? y : oled_target_height;
+    oled_ctx.clip_x_end = (x_end < OLED_WIDTH) ? x_end : OLED_WIDTH;
+    oled_ctx.clip_y_end = (y_end < oled_target_height) ? y_end : oled_target_height;
+}
+
+/**
+ * @breif   òüΣ֮Ļͼֻдڵ
  * @param   x: 0-OLED_LIST
  * @param   y: 0-OLED_HEIGHT
- * @param   str:ַ
- * @param   font_size:С
+ * @param   width: 0-OLED_LIST
+ * @param   height:߶ 0-OLED_HEIGHT
  * @retval  
  */
-void oled_show_font_string(uint8_t x, uint8_t y, const uint8_t *str, uint8_t font_size)
+void oled_set_clip(uint8_t x, uint8_t y, uint8_t width, uint8_t height)
+{
+    oled_clip_set(x, y, x + width, y + height);
+}
+
+/**
+ * @breif   ȡüָΪĻ
+ * @param   
+ * @retval  
+ */
+void oled_reset_clip(void)
+{
+    oled_clip_set(0, 0, OLED_WIDTH, oled_target_height);
+}
+
+/**
+ * @breif   浱ǰͼ
+ * @param   ctx:
+ * @retval  
+ */
+void oled_get_context(oled_context_t *ctx)
+{
+    *ctx = oled_ctx;
+}
+
+/**
+ * @breif   ָͼ
+ * @param   ctx:oled_get_context
+ * @retval  
+ */
+void oled_set_context(const oled_context_t *ctx)
+{
+    oled_set_rop(ctx->rop);
+    oled_clip_set(ctx->clip_x, ctx->clip_y, ctx->clip_x_end, ctx->clip_y_end);
+}
+
+/**
+ * @breif   ûͼĿ
+ * @param   buffer:Ŀ껺壬NULLָΪԴ
+ * @param   pages:ҳ 1-OLED_TARGET_PAGES_MAX
+ * @retval  
+ */
+void oled_set_target(uint8_t *buffer, uint8_t pages)
 {
+    if (buffer != NULL && (pages == 0 || pages > OLED_TARGET_PAGES_MAX))
+        return;
+    oled_target = (uint8_t(*)[OLED_LIST])buffer;
+    oled_target_height = (buffer != NULL) ? pages * 8 : OLED_HEIGHT;
+    oled_reset_clip();
+}
 
-    const char *font_file = (font_size == OLED_FONT_7X12) ? GBK12_FONT_PATH
-                                                          : GBK16_FONT_PATH;
+#if OLED_FONT_GBK_EN
 
-    const uint8_t glyph_bytes = (font_size == OLED_FONT_7X12) ? 24U  /* 1212 ȣ24 ֽ */
-                                                              : 32U; /* 1616 ȣ32 ֽ */
+/**
+ * @breif   תֽڵλ˳ֿļλϣOLEDλ
+ * @param   byte:ԭֽ
+ * @retval  תֽ
+ */
+static uint8_t oled_reverse_bits(uint8_t byte)
+{
+    static const uint8_t nibble[16] = {0x0, 0x8, 0x4, 0xC, 0x2, 0xA, 0x6, 0xE, 0x1, 0x9, 0x5, 0xD, 0x3, 0xB, 0x7, 0xF};
 
-    const uint8_t glyph_width = (font_size == OLED_FONT_7X12) ? 12U  /* 1212 ȣ24 ֽ */
-                                                              : 16U; /* 1616 ȣ32 ֽ */
+    return (nibble[byte & 0x0F] << 4) | nibble[byte >> 4];
+}
 
-    uint8_t font_buf[glyph_bytes];
-    uint8_t oled_buf[glyph_bytes];
+/**
+ * @breif   ȡGBKģȴӻȡδʱֿļ滻δʹõĻ
+ * @param   code:GBK룬ֽǰ
+ * @param   font_size:С OLED_FONT_7X12/OLED_FONT_8X16
+ * @note    ֿļ򿪺󱣳ִ򿪣лֺŻoled_font_closeʱŹر
+ * @retval  OLEDҳʽģÿҳwidthֽڣЧȡʧܷNULL
+ */
+static const uint8_t *oled_glyph_get(uint16_t code, uint8_t font_size)
+{
+    uint8_t high = code >> 8, low = code & 0xFF;
+    uint8_t width = (font_size == OLED_FONT_7X12) ? 12 : 16; /* ȣÿ2ֽ */
+    uint8_t buf[32];
+    uint8_t i, victim = 0;
+    uint32_t offset;
+    UINT br;
+    oled_glyph_t *glyph;
 
-    FIL f;
-    uint8_t res;
-    res = f_open(&f, font_file, FA_READ);
+    if (high < 0x81 || high == 0xFF || low < 0x40 || low == 0x7F || low == 0xFF) // GBK룬ļҲͳ
+        return NULL;
 
-    while (*str)
+    for (i = 0; i < OLED_GLYPH_CACHE_NUM; i++)
+    {
+        if (oled_glyph_cache[i].size == font_size && oled_glyph_cache[i].code == code)
+        {
+            oled_glyph_hit++;
+            oled_glyph_cache[i].stamp = ++oled_glyph_clock;
+            return oled_glyph_cache[i].data;
+        }
+        if (oled_glyph_cache[i].stamp < oled_glyph_cache[victim].stamp)
+            victim = i;
+    }
+    oled_glyph_miss++;
+
+    if (oled_font_size != font_size) // лֿļ
+    {
+        oled_font_close();
+        if (f_open(&oled_font_file, (font_size == OLED_FONT_7X12) ? GBK12_FONT_PATH : GBK16_FONT_PATH, FA_READ) != FR_OK)
+            return NULL;
+        oled_font_size = font_size;
+    }
+
+    /* 0x8140ΪַÿֽڶӦ190ַ0x7F */
+    offset = ((uint32_t)(high - 0x81) * 190 + (low - ((low < 0x7F) ? 0x40 : 0x41))) * width * 2;
+    if (f_lseek(&oled_font_file, offset) != FR_OK || f_read(&oled_font_file, buf, width * 2, &br) != FR_OK || br != width * 2)
+        return NULL;
+
+    glyph = &oled_glyph_cache[victim];
+    for (i = 0; i < width; i++) // ļÿΪϰ벿֡°벿ֽڣתΪOLEDҳ
     {
-        uint8_t kind;
-        if (*str <= 0x7F)
-            kind = 0; /* ׼ ASCII */
-        if (*str >= 0x81)
-            kind = 1; /* GBK ֽ */
+        glyph->data[i] = oled_reverse_bits(buf[i * 2]);
+        glyph->data[width + i] = oled_reverse_bits(buf[i * 2 + 1]);
+    }
+    glyph->code = code;
+    glyph->size = font_size;
+    glyph->stamp = ++oled_glyph_clock;
+    return glyph->data;
+}
+
+/**
+ * @breif   ʾַ
+ * @param   x: 0-OLED_LIST
+ * @param   y: 0-OLED_HEIGHT
+ * @param   str:ַ
+ * @param   font_size:С
+ * @retval  
+ */
+void oled_show_font_string(uint8_t x, uint8_t y, const uint8_t *str, uint8_t font_size)
+{
+    uint8_t width = (font_size == OLED_FONT_7X12) ? 12 : 16;
+    const uint8_t *glyph;
+    uint16_t code;
 
-        /* ---------- ASCII ---------- */
-        if (kind == 0)
+    while (*str)
+    {
+        if (*str <= 0x7F) // ׼ASCII
         {
-            oled_show_char(x, y, *str, font_size);
+            oled_show_char(x, y, *str++, font_size);
             x += font_size;
-            ++str;
+            continue;
         }
-        /* ---------- GBK1616 ---------- */
-        else if (kind == 1)
-        {
-            uint8_t high = *str++;
-            uint8_t low = *str++;
 
-            uint32_t idx = ((uint32_t)(high - 0x81U) * 190U) +
-                           ((uint32_t)(low - ((low < 0x7FU) ? 0x40U : 0x41U))); /* 0x8140 Ϊַʽ̶ */
+        code = *str++ << 8;
+        if (*str == '\0')
+            break;
+        code |= *str++;
 
-            uint32_t offset = idx * glyph_bytes;
+        glyph = oled_glyph_get(code, font_size);
+        if (glyph != NULL)
+            oled_show_image(x, y, glyph, width, width);
+        x += width;
+    }
+}
 
-            if (res == FR_OK)
-            {
-                f_lseek(&f, offset);
-                if (f_read(&f, font_buf, glyph_bytes, &(UINT){0}) == FR_OK)
-                {
-                    for (uint8_t col = 0; col < glyph_width; ++col)
-                    {
-                        uint8_t byte0 = font_buf[col * 2];     // ֽ   0~7
-                        uint8_t byte1 = font_buf[col * 2 + 1]; // ֽ   8~11 4 λЧ
-
-                        // ϰ벿֣ 0~7  תλ˳OLED λ£
-                        uint8_t upper = 0;
-                        for (uint8_t bit = 0; bit < 8; ++bit)
-                            if (byte0 & (1U << bit))
-                                upper |= 1U << (7U - bit);
-                        oled_buf[col] = upper;
-
-                        // °벿֣ 8~11  ֻȡֽڵ 4 λٷת
-                        uint8_t lower = 0;
-                        for (uint8_t bit = 0; bit < 8; ++bit)
-                            if (byte1 & (1U << bit))
-                                lower |= 1U << (7U - bit);
-                        oled_buf[glyph_width + col] = lower;
-                    }
-                    oled_show_image(x, y, oled_buf, glyph_width, glyph_width);
-                }
-            }
-            x += glyph_width;
-        }
+/**
+ * @breif   رֿļжļϵͳǰ
+ * @param   
+ * @retval  
+ */
+void oled_font_close(void)
+{
+    if (oled_font_size != 0)
+    {
+        f_close(&oled_font_file);
+        oled_font_size = 0;
     }
-    f_close(&f);
+}
+
+/**
+ * @breif   ȡģͳ
+ * @param   hit:дΪNULL
+ * @param   miss:δдȡֿļĴЧ룬ΪNULL
+ * @retval  
+ */
+void oled_get_glyph_stats(uint32_t *hit, uint32_t *miss)
+{
+    if (hit != NULL)
+        *hit = oled_glyph_hit;
+    if (miss != NULL)
+        *miss = oled_glyph_miss;
+}
+
+/**
+ * @breif   ģͳ
+ * @param   
+ * @retval  
+ */
+void oled_clear_glyph_stats(void)
+{
+    oled_glyph_hit = 0;
+    oled_glyph_miss = 0;
 }
 #endif
 
@@ -471,23 +2905,23 @@ void oled_show_setting(uint8_t set, uint8_t value)
     {
         cmd[0] = 0x81;
         cmd[1] = value;
-        OLED_WRITE_COMMAND(cmd, 2);
+        oled_write_command(cmd, 2);
     }
     else if (set == 2) /* ĻתX */
     {
         if (value == 0)
-            cmd[0] = 0xA1;
+            cmd[0] = OLED_SEG_REMAP_CMD;
         else
-            cmd[0] = 0xA0;
-        OLED_WRITE_COMMAND(cmd, 1);
+            cmd[0] = OLED_SEG_REMAP_CMD ^ 0x01;
+        oled_write_command(cmd, 1);
     }
     else if (set == 3) /* ĻתY */
     {
         if (value == 0)
-            cmd[0] = 0xC8;
+            cmd[0] = OLED_COM_SCAN_CMD;
         else
-            cmd[0] = 0xC0;
-        OLED_WRITE_COMMAND(cmd, 1);
+            cmd[0] = OLED_COM_SCAN_CMD ^ 0x08;
+        oled_write_command(cmd, 1);
     }
     else if (set == 4) /* Ļɫ */
     {
@@ -495,7 +2929,7 @@ void oled_show_setting(uint8_t set, uint8_t value)
             cmd[0] = 0xA6;
         else
             cmd[0] = 0xA7;
-        OLED_WRITE_COMMAND(cmd, 1);
+        oled_write_command(cmd, 1);
     }
 }
 
@@ -2,46 +2,46 @@
 #define __OLED_H_
 
 /* =========================== û =========================== */
-#include "stdio.h"/*OLEDI2CַʵӲ޸*/
+#include "stdio.h"
 #include "gpio.h"                       /*ûͷļ*/
-#include "i2c.h"                          /*ûͷļ*/
 #include "string.h"
 
-#define OLED_I2C_ADDR 0x78 
-
-extern I2C_HandleTypeDef hi2c1; 
-
-
-
 void oled_test_pattern(void);
-static inline void OLED_INIT_FUNS(void) /* OLEDʼӿ */
-{
-    HAL_Delay(100);
-
-}
-static inline void OLED_WRITE_DATA(uint8_t *data, uint16_t len) /* OLEDдݽӿ */
-{
-	
-     uint8_t tx_buf[len + 1];
-    tx_buf[0] = 0x40;                   /*־*/
-     memcpy(&tx_buf[1], data, len);
-     HAL_I2C_Master_Transmit(&hi2c1, OLED_I2C_ADDR, tx_buf, len + 1, 1000);
-	
-}
-static inline void OLED_WRITE_COMMAND(uint8_t *command, uint16_t len) /* OLEDдӿ */
-{
-   uint8_t tx_buf[len + 1];
-    tx_buf[0] = 0x00;                   /*־*/
-    memcpy(&tx_buf[1], command, len);
-    HAL_I2C_Master_Transmit(&hi2c1, OLED_I2C_ADDR, tx_buf, len + 1, 1000);
-}
 
 // clang-format off
-#define OLED_PAGES              8   /* 8ҳ */
-#define OLED_LIST               128 /* 128 */
+#define OLED_ROTATION           0   /* ˳ʱתǶ 0/90/180/27090270Ϊͼ֮Ϊ64x128 */
+
+#define OLED_PANEL_PAGES        8   /* ĻGDDRAM 8ҳ */
+#define OLED_PANEL_LIST         128 /* ĻGDDRAM 128 */
+
+#if OLED_ROTATION == 90 || OLED_ROTATION == 270
+    #define OLED_TRANSPOSE_EN   1   /* Դ水ͼ֯ˢʱ8x8תΪĻ˳ */
+    #define OLED_PAGES          16  /* 16ҳ */
+    #define OLED_LIST           64  /* 64 */
+    #define OLED_WIDTH          64  /* 64 */
+    #define OLED_HEIGHT         128 /* 128 */
+#else
+    #define OLED_TRANSPOSE_EN   0
+    #define OLED_PAGES          8   /* 8ҳ */
+    #define OLED_LIST           128 /* 128 */
+    #define OLED_WIDTH          128 /* 128 */
+    #define OLED_HEIGHT         64  /* 64 */
+#endif
 
-#define OLED_WIDTH              128 /* 128 */
-#define OLED_HEIGHT             64  /* 64 */
+/* תֻУתӲӳ(0xA0/0xA1)ɨ跽(0xC0/0xC8)180Ȳת */
+#if OLED_ROTATION == 90
+    #define OLED_SEG_REMAP_CMD  0xA0
+    #define OLED_COM_SCAN_CMD   0xC8
+#elif OLED_ROTATION == 180
+    #define OLED_SEG_REMAP_CMD  0xA0
+    #define OLED_COM_SCAN_CMD   0xC0
+#elif OLED_ROTATION == 270
+    #define OLED_SEG_REMAP_CMD  0xA1
+    #define OLED_COM_SCAN_CMD   0xC0
+#else
+    #define OLED_SEG_REMAP_CMD  0xA1
+    #define OLED_COM_SCAN_CMD   0xC8
+#endif
 
 #define OLED_FONT_6X8           6   /* 6x8 */
 #define OLED_FONT_7X12          7   /* 7x12 */
@@ -53,6 +53,43 @@ static inline void OLED_WRITE_COMMAND(uint8_t *command, uint16_t len) /* OLEDд
     #define GBK12_FONT_PATH         "0:/SYSTEM/FONT/GBK12.FON"  // GBK12·
     #define GBK16_FONT_PATH         "0:/SYSTEM/FONT/GBK16.FON"  // GBK16·
     #include "Middlewares/FATFS/ff.h"   // ļϵͳ 
+    #define OLED_GLYPH_CACHE_NUM    16  /* GBKģÿԼ40ֽRAM */
+#endif
+
+#define OLED_ASYNC_EN           1   /* 1-ʹDMA첽ˢ(ѡ䷽ʽ֧DMA) 0-ر */
+#define OLED_DOUBLE_BUFFER_EN   1   /* 1-ʹǰ̨˫壬ʾռˢ 0-ر */
+#define OLED_GOVERNOR_EN        1   /* 1-ʹoled_request_updateϲˢ(贴oled_update_task) 0-ر */
+#define OLED_MAX_FPS            30  /* oled_request_updateϲˢ֡ */
+
+#define OLED_FRAME_LOCK_EN      (OLED_DOUBLE_BUFFER_EN || OLED_GOVERNOR_EN) /* ΪˢʱҪ֡ */
+
+#if OLED_ASYNC_EN || OLED_DOUBLE_BUFFER_EN || OLED_GOVERNOR_EN
+    #include "FreeRTOS.h"
+    #include "task.h"
+#endif
+#if OLED_ASYNC_EN || OLED_FRAME_LOCK_EN
+    #include "semphr.h"
+#endif
+
+#define OLED_I2C_EN             1   /* 1-I2C(I2C1DMAʽTX DMA¼/ж) 0-ر */
+#define OLED_SPI_EN             0   /* 1-SPI(SPI2TX DMAж) 0-ر */
+#define OLED_TRANSPORT          oled_transport_i2c_dma  /* Ĭϴ䷽ʽoled_set_transportڳʼǰ */
+
+#if OLED_I2C_EN
+    #include "i2c.h"                    /*ûͷļ*/
+    #define OLED_I2C_HANDLE     hi2c1   /* I2C */
+    #define OLED_I2C_ADDR       0x78    /* OLEDI2CַʵӲ޸ */
+#endif
+
+#if OLED_SPI_EN
+    #include "spi.h"                    /*ûͷļ*/
+    #define OLED_SPI_HANDLE     hspi2   /* SPI */
+    #define OLED_DC_PORT        GPIOA   /* /ѡ񣬸ߵƽΪ */
+    #define OLED_DC_PIN         GPIO_PIN_8
+    #define OLED_CS_PORT        GPIOC   /* Ƭѡ͵ƽЧ */
+    #define OLED_CS_PIN         GPIO_PIN_6
+    #define OLED_RES_PORT       GPIOB   /* λ͵ƽЧ */
+    #define OLED_RES_PIN        GPIO_PIN_14
 #endif
 
 static const uint8_t oled_init_cmd[] = {
@@ -61,8 +98,8 @@ static const uint8_t oled_init_cmd[] = {
     0xA8, 0x3F,  // ö·ʣ64Ļ0x3F320x1F
     0xD3, 0x00,  // ʾƫƣ0x00ƫ
     0x40,        // ʾʼ
-    0xA1,        // ҷã0xA00xA1
-    0xC8,        // ·ã0xC00xC8
+    OLED_SEG_REMAP_CMD, // ҷã0xA00xA1ãOLED_ROTATIONѡ
+    OLED_COM_SCAN_CMD,  // ·ã0xC00xC8ãOLED_ROTATIONѡ
     0xDA, 0x12,  // COMӲã0x12ʺ64Ļ
     0x81, 0xCF,  // Աȶã0x00~0xFF0xCFΪ߶Աȶȣ
     0xD9, 0xF1,  // Ԥڣ0xF1ʺⲿVCC
@@ -85,6 +122,53 @@ static const uint8_t oled_cursor_cmd[] = {
 /* =========================== ⲿ =========================== */
 
 #include "stdint.h"
+#include "oled_font.h"
+
+/* ӿڣdc:0- 1-Դ */
+typedef struct
+{
+    void (*init)(void);                                            /* ϵʱλ */
+    void (*write)(uint8_t dc, uint8_t *data, uint16_t len);        /*  */
+    uint8_t (*write_dma)(uint8_t dc, uint8_t *data, uint16_t len); /* DMAͣ0ɹNULLʾ֧ */
+    uint8_t overhead;                                              /* ÿδ丽ӵֽ(I2Cֽ)ͳ */
+} oled_transport_t;
+
+#if OLED_I2C_EN
+extern const oled_transport_t oled_transport_i2c;     /* I2Cѯ */
+extern const oled_transport_t oled_transport_i2c_dma; /* I2C DMA */
+#endif
+#if OLED_SPI_EN
+extern const oled_transport_t oled_transport_spi_dma; /* SPI DMADC/CSڴǰ */
+#endif
+
+/* դdΪԴԭأsΪԴ(ͼ/ģĵ㣬Ϊȫ1) */
+typedef enum
+{
+    OLED_ROP_COPY = 0, /* d = s      ǣĬ */
+    OLED_ROP_OR,       /* d = d | s  ͸ */
+    OLED_ROP_AND,      /* d = d & s   */
+    OLED_ROP_XOR,      /* d = d ^ s  ɫӣλԭʺϹ */
+    OLED_ROP_ANDNOT,   /* d = d & ~s ԴΪ1ĵ */
+} oled_rop_t;
+
+/* ͼģoled_show_imageϵ/oled_show_char/oled_show_stringoled_draw_*oled_fill_*ͼ */
+typedef struct
+{
+    oled_rop_t rop;      /* դ */
+    uint8_t clip_x;      /* üʼ */
+    uint8_t clip_y;      /* üʼ */
+    uint16_t clip_x_end; /* üν() */
+    uint16_t clip_y_end; /* üν()ͼĿΪ256ʱɴ256 */
+} oled_context_t;
+
+#define OLED_TARGET_PAGES_MAX   32  /* ͼĿҳΪuint8_t256 */
+
+/* ζ㣬ɳĻ */
+typedef struct
+{
+    int16_t x; /*  */
+    int16_t y; /*  */
+} oled_point_t;
 
 /**
  * @breif   ʼOLED
@@ -93,6 +177,20 @@ static const uint8_t oled_cursor_cmd[] = {
  */
 void oled_init(void);
 
+/**
+ * @breif   ѡOLED䷽ʽoled_init֮ǰ
+ * @param   transport:ӿڣ&oled_transport_i2c
+ * @retval  
+ */
+void oled_set_transport(const oled_transport_t *transport);
+
+/**
+ * @breif   ȡǰOLED䷽ʽ
+ * @param   
+ * @retval  ӿ
+ */
+const oled_transport_t *oled_get_transport(void);
+
 /**
  * @breif   OLEDλ
  * @param   page:ҳ 0-7
@@ -148,10 +246,189 @@ void oled_clear_area(uint8_t x, uint8_t y, uint8_t width, uint8_t height);
  * @param   y: 0-OLED_HEIGHT
  * @param   width: 0-OLED_LIST
  * @param   height:߶ 0-OLED_HEIGHT
+ * @note    ʱһת÷
  * @retval  
  */
 void oled_update_area(uint8_t x, uint8_t y, uint8_t width, uint8_t height);
 
+/**
+ * @breif   ֻˢϴˢ仯
+ * @param   
+ * @note    лͼ¼ҳ仯зΧƼñoled_update_all
+ * @retval  
+ */
+void oled_flush(void);
+
+/**
+ * @breif   ҳֱʾʼƶ棬ֻ貹¶ҳ
+ * @param   pages:ҳơײ¶ҳơ¶ҳ
+ * @note    Դ֮ƶ¶ҳ㣻˫ʱ´oled_swap_buffersЧ
+ *          ʱûжӦӲܣΪ֡ط
+ * @retval  
+ */
+void oled_scroll_vertical(int8_t pages);
+
+/**
+ * @breif   Ӳˮƽڼͣˢ
+ * @param   left:0- 1-
+ * @param   page_start:ʼҳ 0-7ʱΪĻҳҲĻ
+ * @param   page_end:ҳ 0-7
+ * @param   interval:֡ 0-5֡ 1-64֡ 2-128֡ 3-256֡ 4-3֡ 5-4֡ 6-25֡ 7-2֡
+ * @retval  
+ */
+void oled_scroll_horizontal(uint8_t left, uint8_t page_start, uint8_t page_end, uint8_t interval);
+
+/**
+ * @breif   ӲԽǹ(ֱָҳˮƽ)ڼͣˢ
+ * @param   left:0- 1-
+ * @param   page_start:ˮƽʼҳ 0-7
+ * @param   page_end:ˮƽҳ 0-7
+ * @param   interval:֡ͬoled_scroll_horizontal
+ * @param   offset:ÿֱ 1-63
+ * @retval  
+ */
+void oled_scroll_diagonal(uint8_t left, uint8_t page_start, uint8_t page_end, uint8_t interval, uint8_t offset);
+
+/**
+ * @breif   ֹͣӲˮƽ/Խǹָʼвд֡
+ * @param   
+ * @retval  
+ */
+void oled_scroll_stop(void);
+
+/**
+ * @breif   ȡۼƷ͵OLEDֽ
+ * @param   
+ * @retval  ֽ(ֽڣI2Cַ)
+ */
+uint32_t oled_get_tx_bytes(void);
+
+/**
+ * @breif   㷢ֽڼ
+ * @param   
+ * @retval  
+ */
+void oled_clear_tx_bytes(void);
+
+#if OLED_ASYNC_EN
+/**
+ * @breif   DMA첽ˢ
+ * @param   notify_task:ȫɺ֪ͨNULL֪ͨ
+ * @note    ɺжеoled_flush_cplt_callbacknotify_taskִvTaskNotifyGiveFromISR
+ *          ulTaskNotifyTakeȴڼԿɻͼ¸Ķ´ˢʱ
+ * @retval  0-(ʱֱ֪ͨ) 1-һˢδ
+ */
+uint8_t oled_flush_async(TaskHandle_t notify_task);
+
+/**
+ * @breif   ѯ첽ˢǷ
+ * @param   
+ * @retval  0- 1-
+ */
+uint8_t oled_flush_busy(void);
+
+/**
+ * @breif   첽ˢɻص壬ûд
+ * @param   error:0-ɹ 1-ߴ(δ͵´ˢʱ)
+ * @note    жִУ
+ * @retval  
+ */
+void oled_flush_cplt_callback(uint8_t error);
+#endif
+
+#if OLED_DOUBLE_BUFFER_EN
+/**
+ * @breif   ǰ̨岢֪ͨʾˢ
+ * @param   
+ * @note    ͼд̨壬ˢºǰ̨壻ǰ̨ڷʱȴͽٽ
+ *          ̨ᲹΪǰ棬ɼͼ
+ *          ʹܺʾռӦñoled_update_all/oled_flush
+ * @retval  
+ */
+void oled_swap_buffers(void);
+
+/**
+ * @breif   ʾڣMX_FREERTOS_Initд
+ * @param   argument:δʹ
+ * @retval  
+ */
+void oled_display_task(void *argument);
+#endif
+
+#if OLED_FRAME_LOCK_EN
+/**
+ * @breif   ʼһ֡ȡ֡
+ * @param   
+ * @note    oled_update_taskoled_dl_taskˢǰȡ֡ѻһ֡ͳ
+ *          ֱӻͼʱӦһ֡Ļͼoled_swap_buffersoled_frame_begin/oled_frame_end֮䣻
+ *          ͬһǶ(һ֡printf̨)beginendɶ
+ * @retval  
+ */
+void oled_frame_begin(void);
+
+/**
+ * @breif   һ֡ͷ֡
+ * @param   
+ * @retval  
+ */
+void oled_frame_end(void);
+#endif
+
+#if OLED_ASYNC_EN || OLED_DOUBLE_BUFFER_EN
+/**
+ * @breif   ȴ߿У첽ˢѽ˫ʱʾѷǰ̨
+ * @param   
+ * @note    Ӧڳ֡ʱã򷵻غֿʼˢ£ڸ䷽ʽռߵĲ
+ * @retval  
+ */
+void oled_wait_idle(void);
+#endif
+
+#if OLED_GOVERNOR_EN
+/* ϲˢͳƣϲ = requests / flushes */
+typedef struct
+{
+    uint32_t requests;    /* oled_request_updateô */
+    uint32_t flushes;     /* ʵˢ´ */
+    uint32_t bytes;       /* Щˢ·͵OLEDֽ˫ʱͺһ֡ */
+    uint32_t latency_max; /* ׸󵽿ʼˢµʱ䣬λtick */
+} oled_update_stats_t;
+
+/**
+ * @breif   ˢָ򣬶ϲoled_update_task֡ͳһˢ
+ * @param   x: 0-OLED_LIST
+ * @param   y: 0-OLED_HEIGHT
+ * @param   width: 0-OLED_LIST
+ * @param   height:߶ 0-OLED_HEIGHT
+ * @note    еãҪ֡ȴߣͼѼ¼󣬴0߼ɡ
+ *          ɺϲˢȡ֡ٽˢ£ͼӦoled_frame_begin/oled_frame_end֮䣬
+ *          л֮
+ * @retval  
+ */
+void oled_request_update(uint8_t x, uint8_t y, uint8_t width, uint8_t height);
+
+/**
+ * @breif   ϲˢڣMX_FREERTOS_Initдˢ¼С1/OLED_MAX_FPS
+ * @param   argument:δʹ
+ * @retval  
+ */
+void oled_update_task(void *argument);
+
+/**
+ * @breif   ȡϲˢͳ
+ * @param   stats:ͳ
+ * @retval  
+ */
+void oled_get_update_stats(oled_update_stats_t *stats);
+
+/**
+ * @breif   ϲˢͳ
+ * @param   
+ * @retval  
+ */
+void oled_clear_update_stats(void);
+#endif
+
 /**
  * @breif   ʾͼ
  * @param   x: 0-OLED_LIST
@@ -163,6 +440,28 @@ void oled_update_area(uint8_t x, uint8_t y, uint8_t width, uint8_t height);
  */
 void oled_show_image(uint8_t x, uint8_t y, const uint8_t *image, uint8_t width, uint8_t height);
 
+/**
+ * @breif   ʾRLEѹͼ񣬱߽дԴ
+ * @param   x: 0-OLED_LIST
+ * @param   y: 0-OLED_HEIGHT
+ * @param   data:ѹݣTools/oled_imgc.py --compress rle
+ * @param   width: 0-OLED_LIST
+ * @param   height:߶ 0-OLED_HEIGHT
+ * @retval  
+ */
+void oled_show_image_rle(uint8_t x, uint8_t y, const uint8_t *data, uint8_t width, uint8_t height);
+
+/**
+ * @breif   ʾλŵͼ񣬱߽дԴ
+ * @param   x: 0-OLED_LIST
+ * @param   y: 0-OLED_HEIGHT
+ * @param   data:УÿheightλTools/oled_imgc.py --compress packed
+ * @param   width: 0-OLED_LIST
+ * @param   height:߶ 0-OLED_HEIGHT
+ * @retval  
+ */
+void oled_show_image_packed(uint8_t x, uint8_t y, const uint8_t *data, uint8_t width, uint8_t height);
+
 /**
  * @breif   ʾַ
  * @param   x: 0-OLED_LIST
@@ -183,12 +482,32 @@ void oled_show_char(uint8_t x, uint8_t y, uint8_t ch, uint8_t font_size);
  */
 void oled_show_string(uint8_t x, uint8_t y, uint8_t *str, uint8_t font_size);
 
+/**
+ * @breif   ںֿжֲGBK
+ * @param   table:ֿ⣬GBKСУĩβΪδַ֪
+ * @param   count:δַ֪
+ * @param   code:GBK룬ֽǰ
+ * @retval  ģֿûʱĩβδַ֪
+ */
+const OLED_Character_t *oled_find_cjk(const OLED_Character_t *table, uint16_t count, uint16_t code);
+
+/**
+ * @breif   ñɵֿʾַ֧ASCIIGBKֻ
+ * @param   x: 0-OLED_LIST
+ * @param   y: 0-OLED_HEIGHT
+ * @param   str:ַ
+ * @param   font:ֿ⣬Tools/oled_fontc.py
+ * @retval  
+ */
+void oled_show_text(uint8_t x, uint8_t y, const uint8_t *str, const oled_font_t *font);
+
 /**
  * @breif  ɱʽַ
  * @param   x: 0-OLED_LIST
  * @param   y: 0-OLED_HEIGHT
  * @param   font_size:С
- * @param   fmt:ʽַ
+ * @param   fmt:ʽַʽoled_vformat
+ * @note    ߸ʽʾ壬ȲƣĻַ
  * @retval  
  */
 void oled_printf(uint8_t x, uint8_t y, uint8_t font_size, const char *fmt, ...);
@@ -211,6 +530,130 @@ void oled_draw_point(uint8_t x, uint8_t y);
  */
 void oled_draw_rectangle(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t fill);
 
+/**
+ * @breif   ֱ
+ * @param   x0:УɳĻ
+ * @param   y0:
+ * @param   x1:յ
+ * @param   y1:յ
+ * @retval  
+ */
+void oled_draw_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
+/**
+ * @breif   ˮƽ
+ * @param   x:ʼУΪ
+ * @param   y:
+ * @param   width:
+ * @retval  
+ */
+void oled_draw_hline(int16_t x, int16_t y, int16_t width);
+
+/**
+ * @breif   ƴֱ
+ * @param   x:
+ * @param   y:ʼУΪ
+ * @param   height:
+ * @retval  
+ */
+void oled_draw_vline(int16_t x, int16_t y, int16_t height);
+
+/**
+ * @breif   Բ
+ * @param   x:ԲУɳĻ
+ * @param   y:Բ
+ * @param   radius:뾶 0-127
+ * @param   fill:Ƿ 0- 1-
+ * @retval  
+ */
+void oled_draw_circle(int16_t x, int16_t y, uint8_t radius, uint8_t fill);
+
+/**
+ * @breif   Բ
+ * @param   x:ԲУɳĻ
+ * @param   y:Բ
+ * @param   rx:ˮƽ뾶 0-127
+ * @param   ry:ֱ뾶 0-127
+ * @param   fill:Ƿ 0- 1-
+ * @retval  
+ */
+void oled_draw_ellipse(int16_t x, int16_t y, uint8_t rx, uint8_t ry, uint8_t fill);
+
+/**
+ * @breif   Բ
+ * @param   x:ԲУɳĻ
+ * @param   y:Բ
+ * @param   radius:뾶 0-127
+ * @param   start_angle:ʼǣλȣ0ָҷʱΪ
+ * @param   end_angle:ǣ360ȼʱΪԲ
+ * @retval  
+ */
+void oled_draw_arc(int16_t x, int16_t y, uint8_t radius, int16_t start_angle, int16_t end_angle);
+
+/**
+ * @breif   ƶβԶպ
+ * @param   points:
+ * @param   count:
+ * @retval  
+ */
+void oled_draw_polygon(const oled_point_t *points, uint8_t count);
+
+/**
+ * @breif   (żұ±߲)
+ * @param   points:
+ * @param   count: 3-16
+ * @retval  
+ */
+void oled_fill_polygon(const oled_point_t *points, uint8_t count);
+
+/**
+ * @breif   ùդ
+ * @param   rop:դ OLED_ROP_COPY/OR/AND/XOR/ANDNOT
+ * @retval  
+ */
+void oled_set_rop(oled_rop_t rop);
+
+/**
+ * @breif   òüΣ֮Ļͼֻдڵ
+ * @param   x: 0-OLED_LIST
+ * @param   y: 0-OLED_HEIGHT
+ * @param   width: 0-OLED_LIST
+ * @param   height:߶ 0-OLED_HEIGHT
+ * @retval  
+ */
+void oled_set_clip(uint8_t x, uint8_t y, uint8_t width, uint8_t height);
+
+/**
+ * @breif   ȡüָΪĻ
+ * @param   
+ * @retval  
+ */
+void oled_reset_clip(void);
+
+/**
+ * @breif   浱ǰͼ
+ * @param   ctx:
+ * @retval  
+ */
+void oled_get_context(oled_context_t *ctx);
+
+/**
+ * @breif   ָͼ
+ * @param   ctx:oled_get_context
+ * @retval  
+ */
+void oled_set_context(const oled_context_t *ctx);
+
+/**
+ * @breif   ûͼĿ֮꣬ĻͼдָԴ
+ * @param   buffer:Ŀ껺壬ҳʽÿҳOLED_LISTֽڣnҳbuffer[n*OLED_LIST]ʼNULLָΪԴ
+ * @param   pages:ҳ 1-OLED_TARGET_PAGES_MAXbufferΪNULLʱ
+ * @note    ĿϽΪԭ㣬oled_clear_allĿꣻüΪĿꡣ
+ *          дĿ껺岻¼Ӱˢ£⻭(oled_canvas.c)ôʵ
+ * @retval  
+ */
+void oled_set_target(uint8_t *buffer, uint8_t pages);
+
 /**
  * @breif   ʾַ
  * @param   x: 0-OLED_LIST
@@ -221,10 +664,35 @@ void oled_draw_rectangle(uint8_t x, uint8_t y, uint8_t width, uint8_t height, ui
  */
 void oled_show_font_string(uint8_t x, uint8_t y, const uint8_t *str, uint8_t font_size);
 
+#if OLED_FONT_GBK_EN
+/**
+ * @breif   رֿļжļϵͳǰ
+ * @param   
+ * @retval  
+ */
+void oled_font_close(void);
+
+/**
+ * @breif   ȡģͳ
+ * @param   hit:дΪNULL
+ * @param   miss:δдȡֿļĴЧ룬ΪNULL
+ * @retval  
+ */
+void oled_get_glyph_stats(uint32_t *hit, uint32_t *miss);
+
+/**
+ * @breif   ģͳ
+ * @param   
+ * @retval  
+ */
+void oled_clear_glyph_stats(void);
+#endif
+
 /**
  * @breif   OLEDʾ
  * @param   set: 1-Աȶ 2-ĻתX 3-ĻתY 4-Ļɫ
  * @param   value:ֵ
+ * @note    תOLED_ROTATIONķΪ׼ĻX/Y᾵Ӳɣˢ¿
  * @retval  
  */
 void oled_show_setting(uint8_t set, uint8_t value);
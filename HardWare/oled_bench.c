@@ -0,0 +1,601 @@
+#include "oled_bench.h"
+
+#if OLED_BENCH_EN
+
+#include "oled_font.h"
+
+#include "stdarg.h"
+#include "stdio.h"
+#include "string.h"
+
+#if defined(__arm__)
+    #include "main.h"                   /* DWTSystemCoreClock */
+    #define OLED_BENCH_PLATFORM     "target"
+    #define OLED_BENCH_UNIT         "cycles"
+    #define OLED_BENCH_STACK_AREA   OLED_BENCH_STACK_PAINT
+#else
+    #include "time.h"
+    #define OLED_BENCH_PLATFORM     "host"
+    #define OLED_BENCH_UNIT         "ns"
+    #define OLED_BENCH_STACK_AREA   8192 /* ջԣC⺯õҲ */
+#endif
+
+#if defined(__GNUC__) || defined(__CC_ARM)
+    #define OLED_BENCH_NOINLINE     __attribute__((noinline))
+#else
+    #define OLED_BENCH_NOINLINE
+#endif
+
+#define OLED_BENCH_STACK_MARK   0xA5 /* ջͿɫֵ */
+
+typedef struct
+{
+    const char *name;           /*  */
+    void (*op)(uint32_t i);     /* iΪ */
+    uint32_t iterations;        /* ٳOLED_BENCH_SCALE */
+} oled_bench_case_t;
+
+static oled_putc_t oled_bench_putc; /* ص */
+static void *oled_bench_arg;
+
+/* 32x32ͼÿֽڲֹͬȫ0ȫ1Ż */
+static uint8_t oled_bench_image[32 * 32 / 8];
+
+static volatile uintptr_t oled_bench_stack_low; /* Ϳɫ͵ַ */
+
+/* ʽڴĻ壬oled_printfĸʽֶԱ */
+typedef struct
+{
+    char *buf;
+    uint16_t len;
+    uint16_t size;
+} oled_bench_sink_t;
+
+static char oled_bench_text[64];
+
+/**
+ * @breif   ʱ
+ * @param   
+ * @retval  
+ */
+static void oled_bench_timer_init(void)
+{
+#if defined(__arm__)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk; // ʹDWT
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+/**
+ * @breif   ȡʱ32λɻƣɵõ
+ * @param   
+ * @retval  ĿΪCPUΪns
+ */
+static uint32_t oled_bench_timer_now(void)
+{
+#if defined(__arm__)
+    return DWT->CYCCNT;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000U + ts.tv_nsec);
+#endif
+}
+
+/**
+ * @breif   ʱƵ
+ * @param   
+ * @retval  ÿֵ
+ */
+static uint32_t oled_bench_timer_hz(void)
+{
+#if defined(__arm__)
+    return SystemCoreClock;
+#else
+    return 1000000000U;
+#endif
+}
+
+/**
+ * @breif   ѵǰջָ·һջͿɫ
+ * @param   
+ * @note    Ϳɫλڵջ֮֡£ͬһеõı⺯дõĲ
+ * @retval  
+ */
+static OLED_BENCH_NOINLINE void oled_bench_stack_paint(void)
+{
+    volatile uint8_t area[OLED_BENCH_STACK_AREA];
+    uint16_t i;
+
+    for (i = 0; i < OLED_BENCH_STACK_AREA; i++)
+        area[i] = OLED_BENCH_STACK_MARK;
+    oled_bench_stack_low = (uintptr_t)area;
+}
+
+/**
+ * @breif   Ϳɫײҵһдֽ
+ * @param   
+ * @note    oled_bench_stack_paintͬһеãͿɫڵǰջ֮֡£ȡд
+ * @retval  ⺯õջֽ
+ */
+static OLED_BENCH_NOINLINE uint16_t oled_bench_stack_used(void)
+{
+    const volatile uint8_t *area = (const volatile uint8_t *)oled_bench_stack_low;
+    uint16_t i;
+
+    for (i = 0; i < OLED_BENCH_STACK_AREA && area[i] == OLED_BENCH_STACK_MARK; i++)
+        ;
+    return OLED_BENCH_STACK_AREA - i;
+}
+
+/**
+ * @breif   մ䣬ֻݣʹˢ²Բʱ
+ * @param   
+ * @retval  
+ */
+static void oled_bench_null_init(void)
+{
+}
+
+static void oled_bench_null_write(uint8_t dc, uint8_t *data, uint16_t len)
+{
+    (void)dc;
+    (void)data;
+    (void)len;
+}
+
+static const oled_transport_t oled_bench_null = {oled_bench_null_init, oled_bench_null_write, NULL, 0};
+
+static void oled_bench_char_6x8(uint32_t i)
+{
+    oled_show_char((i % 20) * 6, 0, 'A' + i % 26, OLED_FONT_6X8);
+}
+
+static void oled_bench_char_8x16(uint32_t i)
+{
+    oled_show_char((i % 15) * 8, 8, 'A' + i % 26, OLED_FONT_8X16);
+}
+
+static void oled_bench_string_6x8(uint32_t i)
+{
+    oled_show_string(i % 8, 0, (uint8_t *)"Hello OLED 0123", OLED_FONT_6X8);
+}
+
+static void oled_bench_string_7x12(uint32_t i)
+{
+    oled_show_string(i % 8, 8, (uint8_t *)"Hello OLED 012", OLED_FONT_7X12);
+}
+
+static void oled_bench_string_8x16(uint32_t i)
+{
+    oled_show_string(i % 8, 24, (uint8_t *)"Hello OLED 01", OLED_FONT_8X16);
+}
+
+static uint8_t oled_bench_frame[OLED_PAGES][OLED_LIST]; /* ʵдԴ */
+
+/**
+ * @breif   Ϊ鴫֮ǰoled_show_imageΪ
+ * @param   x:
+ * @param   y:
+ * @param   image:ͼ
+ * @param   width:
+ * @param   height:߶
+ * @note    (ʱoled_clear_area)ҳͼλORԴ棻
+ *          Դ治ɴⲿʣд뱾ļĻ壬ֻ˱
+ * @retval  
+ */
+static void oled_bench_image_ref(uint8_t x, uint8_t y, const uint8_t *image, uint8_t width, uint8_t height)
+{
+    uint8_t i, j;
+    uint8_t page, shift;
+
+    for (i = y; i < y + height; i++)
+    {
+        for (j = x; j < x + width; j++)
+        {
+            if (i < OLED_HEIGHT && j < OLED_WIDTH)
+                oled_bench_frame[i / OLED_PAGES][j] &= ~(0x01 << (i % 8));
+        }
+    }
+    for (i = 0; i < (height - 1) / OLED_PAGES + 1; i++)
+    {
+        for (j = 0; j < width; j++)
+        {
+            if (x + j < OLED_WIDTH)
+            {
+                page = y / OLED_PAGES;
+                shift = y % OLED_PAGES;
+                if (page + i < OLED_PAGES)
+                    oled_bench_frame[page + i][x + j] |= image[i * width + j] << (shift);
+                if (page + i + 1 < OLED_PAGES)
+                    oled_bench_frame[page + i + 1][x + j] |= image[i * width + j] >> (OLED_PAGES - shift);
+            }
+        }
+    }
+}
+
+static void oled_bench_glyph_8x16_blit(uint32_t i)
+{
+    oled_show_image((i % 15) * 8, 8 + i % 8, oled_font_8x16['A' - ' ' + i % 26], 8, 16);
+}
+
+static void oled_bench_glyph_8x16_ref(uint32_t i)
+{
+    oled_bench_image_ref((i % 15) * 8, 8 + i % 8, oled_font_8x16['A' - ' ' + i % 26], 8, 16);
+}
+
+static void oled_bench_string_cjk12(uint32_t i)
+{
+    oled_show_string(i % 8, 40, (uint8_t *)"\xB5\xB1\xC7\xB0\xCE\xC2\xB6\xC8", OLED_FONT_7X12); /* "ǰ¶"GBK */
+}
+
+static void oled_bench_string_cjk16(uint32_t i)
+{
+    oled_show_string(i % 8, 40, (uint8_t *)"\xC4\xE3\xBA\xC3\xCA\xC0\xBD\xE7", OLED_FONT_8X16); /* ""GBK */
+}
+
+/* 200ֵĺϳֿ⣬GBK0xB0A1λĩβΪյδַֻ֪Ҳʾ */
+#define OLED_BENCH_CJK_NUM      200
+#define OLED_BENCH_CJK(n)       {{0xB0 + (n) / 94, 0xA1 + (n) % 94, 0}, {0}}
+#define OLED_BENCH_CJK10(n)     OLED_BENCH_CJK(n), OLED_BENCH_CJK(n + 1), OLED_BENCH_CJK(n + 2), OLED_BENCH_CJK(n + 3), \
+                                OLED_BENCH_CJK(n + 4), OLED_BENCH_CJK(n + 5), OLED_BENCH_CJK(n + 6), OLED_BENCH_CJK(n + 7), \
+                                OLED_BENCH_CJK(n + 8), OLED_BENCH_CJK(n + 9)
+#define OLED_BENCH_CJK50(n)     OLED_BENCH_CJK10(n), OLED_BENCH_CJK10(n + 10), OLED_BENCH_CJK10(n + 20), \
+                                OLED_BENCH_CJK10(n + 30), OLED_BENCH_CJK10(n + 40)
+
+static const OLED_Character_t oled_bench_cjk[OLED_BENCH_CJK_NUM + 1] = {
+    OLED_BENCH_CJK50(0), OLED_BENCH_CJK50(50), OLED_BENCH_CJK50(100), OLED_BENCH_CJK50(150), {"", {0}},
+};
+
+static const OLED_Character_t *volatile oled_bench_glyph; /* ҽֹŻ */
+
+/**
+ * @breif   ȡϳֿеnֵGBK룬7Ծλþȷֲ
+ * @param   i:
+ * @retval  ַ0β
+ */
+static const char *oled_bench_cjk_key(uint32_t i)
+{
+    return (const char *)oled_bench_cjk[(i * 7) % OLED_BENCH_CJK_NUM].Index;
+}
+
+static void oled_bench_cjk_binary(uint32_t i)
+{
+    const uint8_t *key = (const uint8_t *)oled_bench_cjk_key(i);
+
+    oled_bench_glyph = oled_find_cjk(oled_bench_cjk, OLED_BENCH_CJK_NUM, (key[0] << 8) | key[1]);
+}
+
+static void oled_bench_cjk_strcmp(uint32_t i)
+{
+    const char *key = oled_bench_cjk_key(i);
+    uint16_t index;
+
+    /* Ϊֲ֮ǰoled_show_stringstrcmpֱյδַ֪ */
+    for (index = 0; strcmp((const char *)oled_bench_cjk[index].Index, "") != 0; index++)
+    {
+        if (strcmp((const char *)oled_bench_cjk[index].Index, key) == 0)
+            break;
+    }
+    oled_bench_glyph = &oled_bench_cjk[index];
+}
+
+/* 100x40ͼ꣬߿ʵĿTools/oled_imgc.pyɣԭRLEһ */
+/*100أ40 500ֽ*/
+static const uint8_t oled_bench_logo[] = {
+    0xFF, 0x01, 0x01, 0x01, 0x01, 0x01, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+    0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+    0xC1, 0xC1, 0xC1, 0xC1, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x87, 0x80, 0x80, 0x80,
+    0x87, 0x80, 0x80, 0x80, 0x87, 0x80, 0x80, 0x80, 0x87, 0x80, 0x80, 0x80, 0x87, 0x80, 0x80, 0x80,
+    0x87, 0x80, 0x80, 0x80, 0x87, 0x80, 0x80, 0x80, 0x87, 0x80, 0x80, 0x80, 0x87, 0x80, 0x80, 0x80,
+    0x87, 0x80, 0x80, 0x80, 0x87, 0x80, 0x80, 0x80, 0x87, 0x80, 0x80, 0x80, 0x87, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFF,
+};
+/*100أ40 rle 110ֽڣԭ500ֽ*/
+static const uint8_t oled_bench_logo_rle[] = {
+    0x00, 0xFF, 0x82, 0x01, 0x9B, 0xC1, 0xBC, 0x01, 0x01, 0xFF, 0xFF, 0x82, 0x00, 0x9B, 0xFF, 0x85,
+    0x00, 0xAF, 0x44, 0x82, 0x00, 0x01, 0xFF, 0xFF, 0x82, 0x00, 0x9B, 0xFF, 0x85, 0x00, 0xAF, 0x44,
+    0x82, 0x00, 0x01, 0xFF, 0xFF, 0x82, 0x00, 0x9B, 0xFF, 0x85, 0x00, 0xAF, 0x44, 0x82, 0x00, 0x01,
+    0xFF, 0xFF, 0x82, 0x80, 0x9B, 0x83, 0x85, 0x80, 0x00, 0x87, 0x80, 0x80, 0x00, 0x87, 0x80, 0x80,
+    0x00, 0x87, 0x80, 0x80, 0x00, 0x87, 0x80, 0x80, 0x00, 0x87, 0x80, 0x80, 0x00, 0x87, 0x80, 0x80,
+    0x00, 0x87, 0x80, 0x80, 0x00, 0x87, 0x80, 0x80, 0x00, 0x87, 0x80, 0x80, 0x00, 0x87, 0x80, 0x80,
+    0x00, 0x87, 0x80, 0x80, 0x00, 0x87, 0x80, 0x80, 0x00, 0x87, 0x83, 0x80, 0x00, 0xFF,
+};
+
+#define OLED_BENCH_PACKED_7X12  11 /* 7x12ģнŵֽ7*12λԭΪ14ֽ */
+
+/* 7x12 ASCIIֿⰴнţʱoled_font_7x12ת951045ֽڣԭ1330ֽ */
+static uint8_t oled_bench_packed_7x12[95][OLED_BENCH_PACKED_7X12];
+
+/**
+ * @breif   7x12 ASCIIֿתΪoled_show_image_packedĸʽͬTools/oled_fontc.py --compress packed
+ * @param   
+ * @retval  
+ */
+static void oled_bench_pack_7x12(void)
+{
+    uint8_t ch, x, y;
+    uint16_t n;
+
+    memset(oled_bench_packed_7x12, 0, sizeof(oled_bench_packed_7x12));
+    for (ch = 0; ch < 95; ch++)
+    {
+        n = 0;
+        for (x = 0; x < 7; x++)
+        {
+            for (y = 0; y < 12; y++, n++)
+            {
+                if (oled_font_7x12[ch][(y / 8) * 7 + x] & (1 << (y % 8)))
+                    oled_bench_packed_7x12[ch][n / 8] |= 1 << (n % 8);
+            }
+        }
+    }
+}
+
+static void oled_bench_glyph_7x12_raw(uint32_t i)
+{
+    oled_show_image((i % 18) * 7, 8 + i % 8, oled_font_7x12['A' - ' ' + i % 26], 7, 12);
+}
+
+static void oled_bench_glyph_7x12_packed(uint32_t i)
+{
+    oled_show_image_packed((i % 18) * 7, 8 + i % 8, oled_bench_packed_7x12['A' - ' ' + i % 26], 7, 12);
+}
+
+static void oled_bench_image_raw_logo(uint32_t i)
+{
+    oled_show_image(i % 28, 8 + i % 8, oled_bench_logo, 100, 40);
+}
+
+static void oled_bench_image_rle_logo(uint32_t i)
+{
+    oled_show_image_rle(i % 28, 8 + i % 8, oled_bench_logo_rle, 100, 40);
+}
+
+static void oled_bench_image_aligned(uint32_t i)
+{
+    oled_show_image(i % 96, 16, oled_bench_image, 32, 32);
+}
+
+static void oled_bench_image_unaligned(uint32_t i)
+{
+    oled_show_image(i % 96, 19, oled_bench_image, 32, 32);
+}
+
+static void oled_bench_fill_rect(uint32_t i)
+{
+    oled_draw_rectangle(i % 32 + 3, 5, 64, 40, 1);
+}
+
+static void oled_bench_clear_area(uint32_t i)
+{
+    oled_clear_area(i % 32 + 5, 3, 60, 30);
+}
+
+static void oled_bench_clear_all(uint32_t i)
+{
+    (void)i;
+    oled_clear_all();
+}
+
+static void oled_bench_printf(uint32_t i)
+{
+    oled_printf(0, 48, OLED_FONT_6X8, "%5d %6.2f", (int)i, 1.25);
+}
+
+/**
+ * @breif   ʽдڴ滺壬ʱض
+ * @param   arg:
+ * @param   ch:ַ
+ * @retval  
+ */
+static void oled_bench_sink_putc(void *arg, char ch)
+{
+    oled_bench_sink_t *sink = (oled_bench_sink_t *)arg;
+
+    if (sink->len + 1 < sink->size)
+        sink->buf[sink->len++] = ch;
+}
+
+/**
+ * @breif   oled_vformatʽ64ֽڻ
+ * @param   fmt:ʽַ
+ * @retval  
+ */
+static void oled_bench_vformat(const char *fmt, ...)
+{
+    oled_bench_sink_t sink = {oled_bench_text, 0, sizeof(oled_bench_text)};
+    va_list args;
+
+    va_start(args, fmt);
+    oled_vformat(oled_bench_sink_putc, &sink, fmt, args);
+    va_end(args);
+    sink.buf[sink.len] = '\0';
+}
+
+/**
+ * @breif   Cvsnprintfʽ64ֽڻ壬Ϊoled_vformatĶ
+ * @param   fmt:ʽַ
+ * @retval  
+ */
+static void oled_bench_vsnprintf(const char *fmt, ...)
+{
+    va_list args;
+
+    va_start(args, fmt);
+    vsnprintf(oled_bench_text, sizeof(oled_bench_text), fmt, args);
+    va_end(args);
+}
+
+static void oled_bench_format_oled(uint32_t i)
+{
+    oled_bench_vformat("%5d %6.2f", (int)i, 1.25);
+}
+
+static void oled_bench_format_libc(uint32_t i)
+{
+    oled_bench_vsnprintf("%5d %6.2f", (int)i, 1.25);
+}
+
+static void oled_bench_flush_full(uint32_t i)
+{
+    (void)i;
+    oled_update_all(); // ֡1024ֽ
+}
+
+#if !OLED_DOUBLE_BUFFER_EN
+static void oled_bench_flush_column(uint32_t i)
+{
+    oled_draw_vline(i % OLED_WIDTH, 0, OLED_HEIGHT); // һп8ҳռβƴһ
+    oled_flush();
+}
+#endif
+
+static const oled_bench_case_t oled_bench_cases[] = {
+    {"show_char_6x8", oled_bench_char_6x8, 2000},
+    {"show_char_8x16", oled_bench_char_8x16, 2000},
+    {"show_string_6x8", oled_bench_string_6x8, 500},
+    {"show_string_7x12", oled_bench_string_7x12, 500},
+    {"show_string_8x16", oled_bench_string_8x16, 500},
+    {"glyph_8x16_blit", oled_bench_glyph_8x16_blit, 2000},
+    {"glyph_8x16_ref", oled_bench_glyph_8x16_ref, 2000},
+    {"show_string_cjk12", oled_bench_string_cjk12, 500},
+    {"show_string_cjk16", oled_bench_string_cjk16, 500},
+    {"cjk_lookup_binary_200", oled_bench_cjk_binary, 2000},
+    {"cjk_lookup_strcmp_200", oled_bench_cjk_strcmp, 2000},
+    {"show_image_aligned", oled_bench_image_aligned, 500},
+    {"show_image_raw_100x40", oled_bench_image_raw_logo, 500},
+    {"show_image_rle_100x40", oled_bench_image_rle_logo, 500},
+    {"glyph_7x12_raw", oled_bench_glyph_7x12_raw, 2000},
+    {"glyph_7x12_packed", oled_bench_glyph_7x12_packed, 2000},
+    {"show_image_unaligned", oled_bench_image_unaligned, 500},
+    {"fill_rect_64x40", oled_bench_fill_rect, 500},
+    {"clear_area_60x30", oled_bench_clear_area, 500},
+    {"clear_all", oled_bench_clear_all, 500},
+    {"printf_6x8", oled_bench_printf, 500},
+    {"format_vformat_64", oled_bench_format_oled, 2000},
+    {"format_vsnprintf_64", oled_bench_format_libc, 2000},
+    {"flush_full", oled_bench_flush_full, 200},
+#if !OLED_DOUBLE_BUFFER_EN
+    {"flush_column", oled_bench_flush_column, 500},
+#endif
+};
+
+/**
+ * @breif   ʽ
+ * @param   fmt:ʽַ
+ * @retval  
+ */
+static void oled_bench_print(const char *fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    oled_vformat(oled_bench_putc, oled_bench_arg, fmt, args);
+    va_end(args);
+}
+
+/**
+ * @breif   лͼ׼ԣʱ
+ * @param   format:ʽ OLED_BENCH_CSV/OLED_BENCH_JSON
+ * @param   putc:ַص
+ * @param   arg:ص
+ * @retval  
+ */
+void oled_bench_run(uint8_t format, oled_putc_t putc, void *arg)
+{
+    const oled_transport_t *transport;
+    const oled_bench_case_t *bench;
+    oled_context_t ctx;
+    uint32_t i, n, start, ticks, hz, per_op, ns_per_op;
+    uint16_t stack;
+    uint8_t c;
+
+    oled_bench_putc = putc;
+    oled_bench_arg = arg;
+    for (i = 0; i < sizeof(oled_bench_image); i++)
+        oled_bench_image[i] = (uint8_t)(i * 37 + 11);
+    oled_bench_pack_7x12();
+
+#if OLED_FRAME_LOCK_EN
+    oled_frame_begin(); // ٽˢ
+#endif
+#if OLED_ASYNC_EN || OLED_DOUBLE_BUFFER_EN
+    oled_wait_idle(); // ڽеķͽܸ䷽ʽ
+#endif
+    transport = oled_get_transport();
+    oled_set_transport(&oled_bench_null);
+    oled_get_context(&ctx);
+    oled_set_rop(OLED_ROP_COPY);
+    oled_reset_clip();
+    oled_bench_timer_init();
+    hz = oled_bench_timer_hz();
+
+    if (format == OLED_BENCH_JSON)
+        oled_bench_print("{\"platform\":\"%s\",\"unit\":\"%s\",\"clock_hz\":%u,\"results\":[",
+                         OLED_BENCH_PLATFORM, OLED_BENCH_UNIT, (unsigned int)hz);
+    else
+        oled_bench_print("name,iterations,per_op,unit,ns_per_op,stack_bytes\n");
+
+    for (c = 0; c < sizeof(oled_bench_cases) / sizeof(oled_bench_cases[0]); c++)
+    {
+        bench = &oled_bench_cases[c];
+        n = bench->iterations * OLED_BENCH_SCALE;
+        oled_clear_all();
+        oled_bench_stack_paint();
+        bench->op(0); // Ԥȣų״εõĻʼͬʱջ
+        stack = oled_bench_stack_used();
+
+        start = oled_bench_timer_now();
+        for (i = 0; i < n; i++)
+            bench->op(i);
+        ticks = oled_bench_timer_now() - start;
+
+        per_op = (uint32_t)((uint64_t)ticks * 10 / n); // һλС
+        ns_per_op = (uint32_t)((uint64_t)ticks * 1000000000U / hz / n);
+        if (format == OLED_BENCH_JSON)
+            oled_bench_print("%s{\"name\":\"%s\",\"iterations\":%u,\"per_op\":%u.%u,\"ns_per_op\":%u,\"stack_bytes\":%u}",
+                             c ? "," : "", bench->name, (unsigned int)n, (unsigned int)(per_op / 10),
+                             (unsigned int)(per_op % 10), (unsigned int)ns_per_op, (unsigned int)stack);
+        else
+            oled_bench_print("%s,%u,%u.%u,%s,%u,%u\n", bench->name, (unsigned int)n, (unsigned int)(per_op / 10),
+                             (unsigned int)(per_op % 10), OLED_BENCH_UNIT, (unsigned int)ns_per_op, (unsigned int)stack);
+    }
+    if (format == OLED_BENCH_JSON)
+        oled_bench_print("]}\n");
+
+    oled_set_context(&ctx);
+    oled_set_transport(transport);
+    oled_clear_all();
+    oled_update_all();
+#if OLED_FRAME_LOCK_EN
+    oled_frame_end();
+#endif
+}
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef __OLED_BENCH_H_
+#define __OLED_BENCH_H_
+
+#include "oled.h"
+#include "oled_format.h"
+
+// clang-format off
+/* =========================== û =========================== */
+#define OLED_BENCH_EN           0   /* 1-ͼ׼(ڼռʾ) 0-ر */
+#define OLED_BENCH_SCALE        1   /* ıʱʱ */
+#define OLED_BENCH_STACK_PAINT  512 /* ĿϲջʱͿɫֽջٶԼ200ֽ */
+// clang-format on
+
+#define OLED_BENCH_CSV          0   /* CSVΪͷ */
+#define OLED_BENCH_JSON         1   /* һJSON */
+
+/* =========================== ⲿ =========================== */
+#if OLED_BENCH_EN
+
+/**
+ * @breif   лͼ׼ԣʱ
+ * @param   format:ʽ OLED_BENCH_CSV/OLED_BENCH_JSON
+ * @param   putc:ַص紮ڷ
+ * @param   arg:ص
+ * @note    ĿDWTڼʱλcyclesõʱӣλns߶ns/op
+ *          ڼ任ÿմ䣬ֻCPUʱ䣻дԴ棬ˢ¡
+ *          Գ֡ȵȴ߿УĻͼˢͣԽ
+ *          ֽڼ(oled_get_tx_bytes)Եˢ¡
+ *          ÿջǰջ·OLED_BENCH_STACK_PAINTֽ(8KB)ͿɫúұдΪֽڣ
+ *          ͿɫΧʱʾΪͿɫֽ
+ * @retval  
+ */
+void oled_bench_run(uint8_t format, oled_putc_t putc, void *arg);
+#endif
+
+#endif
@@ -0,0 +1,311 @@
+#include "oled_canvas.h"
+
+#include "string.h"
+
+static oled_context_t oled_canvas_ctx;         /* oled_canvas_beginʱĻͼ */
+static const oled_canvas_t *oled_canvas_shown; /* ĻӿĻNULLʾ´ */
+static uint8_t oled_canvas_row[OLED_LIST];     /* λƴӺһҳ */
+#if OLED_CANVAS_COMPRESS_EN
+static uint8_t oled_canvas_unpack[2][OLED_LIST]; /* ҳӿڲʱҳƴ */
+#endif
+
+#if OLED_CANVAS_COMPRESS_EN
+/**
+ * @breif   һԭֽ
+ * @param   src:Դ
+ * @param   count:ֽ 1-128
+ * @param   out:NULLʱֻ
+ * @retval  ֽ
+ */
+static uint16_t oled_canvas_literal(const uint8_t *src, uint8_t count, uint8_t *out)
+{
+    if (out != NULL)
+    {
+        out[0] = count - 1;
+        memcpy(&out[1], src, count);
+    }
+    return count + 1;
+}
+
+/**
+ * @breif   RLEһҳʽͬoled_show_image_rle
+ * @param   src:һҳݣOLED_LISTֽ
+ * @param   out:NULLʱֻ
+ * @note    c<0x80ʱc+1ԭֽڣc>=0x80ʱ1ֽڲظ(c&0x7F)+3Σҳɰҳ
+ * @retval  ֽ
+ */
+static uint16_t oled_canvas_encode(const uint8_t *src, uint8_t *out)
+{
+    uint16_t i = 0, run, len = 0;
+    uint8_t literal = 0; /* ԭֽ */
+
+    while (i < OLED_LIST)
+    {
+        for (run = 1; i + run < OLED_LIST && src[i + run] == src[i] && run < 130; run++)
+            ;
+        if (run >= 3) // 3ֽͬڲֵñΪظ
+        {
+            if (literal > 0)
+            {
+                len += oled_canvas_literal(&src[i - literal], literal, out ? &out[len] : NULL);
+                literal = 0;
+            }
+            if (out != NULL)
+            {
+                out[len] = 0x80 | (run - 3);
+                out[len + 1] = src[i];
+            }
+            len += 2;
+            i += run;
+        }
+        else
+        {
+            literal++;
+            i++;
+            if (literal == 128)
+            {
+                len += oled_canvas_literal(&src[i - literal], literal, out ? &out[len] : NULL);
+                literal = 0;
+            }
+        }
+    }
+    if (literal > 0)
+        len += oled_canvas_literal(&src[i - literal], literal, out ? &out[len] : NULL);
+    return len;
+}
+
+/**
+ * @breif   һҳ
+ * @param   data:ҳѹ
+ * @param   dst:OLED_LISTֽ
+ * @retval  
+ */
+static void oled_canvas_decode(const uint8_t *data, uint8_t *dst)
+{
+    uint8_t ctrl, count;
+    uint16_t i = 0;
+
+    while (i < OLED_LIST)
+    {
+        ctrl = *data++;
+        if (ctrl < 0x80)
+        {
+            count = ctrl + 1;
+            memcpy(&dst[i], data, count);
+            data += count;
+        }
+        else
+        {
+            count = (ctrl & 0x7F) + 3;
+            memset(&dst[i], *data++, count);
+        }
+        i += count;
+    }
+}
+#endif
+
+/**
+ * @breif   ȡһҳ
+ * @param   canvas:
+ * @param   page:ҳ
+ * @param   unpack:ѹʱĽ뻺
+ * @retval  ҳ
+ */
+static const uint8_t *oled_canvas_page(const oled_canvas_t *canvas, uint8_t page, uint8_t *unpack)
+{
+#if OLED_CANVAS_COMPRESS_EN
+    const uint8_t *index = canvas->packed;
+
+    if (index != NULL)
+    {
+        oled_canvas_decode(&index[index[page * 2] | (index[page * 2 + 1] << 8)], unpack);
+        return unpack;
+    }
+#else
+    (void)unpack;
+#endif
+    return &canvas->buffer[page * OLED_LIST];
+}
+
+/**
+ * @breif   ʼ
+ * @param   canvas:
+ * @param   buffer:壬pages*OLED_LISTֽ
+ * @param   pages:ҳ OLED_PAGES-OLED_TARGET_PAGES_MAX
+ * @retval  
+ */
+void oled_canvas_init(oled_canvas_t *canvas, uint8_t *buffer, uint8_t pages)
+{
+    if (pages < OLED_PAGES)
+        pages = OLED_PAGES;
+    if (pages > OLED_TARGET_PAGES_MAX)
+        pages = OLED_TARGET_PAGES_MAX;
+    canvas->buffer = buffer;
+#if OLED_CANVAS_COMPRESS_EN
+    canvas->packed = NULL;
+#endif
+    canvas->pages = pages;
+    canvas->view_y = 0;
+    memset(buffer, 0, pages * OLED_LIST);
+    if (oled_canvas_shown == canvas)
+        oled_canvas_shown = NULL;
+}
+
+/**
+ * @breif   ʼڻϻͼ
+ * @param   canvas:
+ * @retval  
+ */
+void oled_canvas_begin(oled_canvas_t *canvas)
+{
+    if (canvas->buffer == NULL) // ѹoled_canvas_expand
+        return;
+    oled_get_context(&oled_canvas_ctx);
+    oled_set_target(canvas->buffer, canvas->pages);
+    if (oled_canvas_shown == canvas) // ݽı䣬Ļϵӿ
+        oled_canvas_shown = NULL;
+}
+
+/**
+ * @breif   ͼ
+ * @param   
+ * @retval  
+ */
+void oled_canvas_end(void)
+{
+    oled_set_target(NULL, 0);
+    oled_set_context(&oled_canvas_ctx);
+}
+
+/**
+ * @breif   ƶӿڲѿɼָƵԴ
+ * @param   canvas:
+ * @param   y:ӿʼ
+ * @retval  
+ */
+void oled_canvas_view(oled_canvas_t *canvas, uint8_t y)
+{
+    oled_context_t ctx;
+    const uint8_t *lo, *hi;
+    uint8_t *unpack0 = NULL, *unpack1 = NULL;
+    uint8_t first = 0, count = OLED_PAGES, shift = y % 8;
+    uint8_t i, page, x;
+    int16_t delta;
+
+    if (y > canvas->pages * 8 - OLED_HEIGHT)
+    {
+        y = canvas->pages * 8 - OLED_HEIGHT;
+        shift = y % 8;
+    }
+    if (oled_canvas_shown == canvas)
+    {
+        if (y == canvas->view_y) // ĻǸӿ
+            return;
+        if (shift == 0 && canvas->view_y % 8 == 0) // ҳƽƣʼƶ棬ֻ¶ҳ
+        {
+            delta = (y - canvas->view_y) / 8;
+            if (delta > -OLED_PAGES && delta < OLED_PAGES)
+            {
+                oled_scroll_vertical(delta);
+                count = (delta > 0) ? delta : -delta;
+                first = (delta > 0) ? OLED_PAGES - count : 0;
+            }
+        }
+    }
+    canvas->view_y = y;
+    oled_canvas_shown = canvas;
+
+#if OLED_CANVAS_COMPRESS_EN
+    unpack0 = oled_canvas_unpack[0];
+    unpack1 = oled_canvas_unpack[1];
+#endif
+    oled_get_context(&ctx); // øǷʽҳд룬ûǰͼӰ
+    oled_set_rop(OLED_ROP_COPY);
+    oled_reset_clip();
+
+    lo = oled_canvas_page(canvas, y / 8 + first, unpack0);
+    for (i = 0; i < count; i++)
+    {
+        page = first + i;
+        if (shift == 0) // ʱֱҳ
+        {
+            oled_show_image(0, page * 8, lo, OLED_LIST, 8);
+            if (i + 1 < count)
+                lo = oled_canvas_page(canvas, y / 8 + page + 1, unpack0);
+        }
+        else // ʱÿҳɻҳƴ
+        {
+            hi = oled_canvas_page(canvas, y / 8 + page + 1, (i % 2) ? unpack0 : unpack1);
+            for (x = 0; x < OLED_LIST; x++)
+                oled_canvas_row[x] = (lo[x] >> shift) | (hi[x] << (8 - shift));
+            oled_show_image(0, page * 8, oled_canvas_row, OLED_LIST, 8);
+            lo = hi;
+        }
+    }
+    oled_set_context(&ctx);
+}
+
+/**
+ * @breif   ʹ´oled_canvas_view
+ * @param   
+ * @retval  
+ */
+void oled_canvas_invalidate(void)
+{
+    oled_canvas_shown = NULL;
+}
+
+#if OLED_CANVAS_COMPRESS_EN
+/**
+ * @breif   ѻѹ洢
+ * @param   canvas:
+ * @param   out:ѹNULLʱֻֽ
+ * @param   size:out
+ * @retval  ѹֽʧܷ0
+ */
+uint16_t oled_canvas_compress(oled_canvas_t *canvas, uint8_t *out, uint16_t size)
+{
+    uint16_t total, offset;
+    uint8_t page;
+
+    if (canvas->buffer == NULL)
+        return 0;
+    total = (canvas->pages + 1) * 2; // ҳƫƱ
+    for (page = 0; page < canvas->pages; page++)
+        total += oled_canvas_encode(&canvas->buffer[page * OLED_LIST], NULL);
+    if (out == NULL)
+        return total;
+    if (total > size)
+        return 0;
+
+    offset = (canvas->pages + 1) * 2;
+    for (page = 0; page <= canvas->pages; page++) // һΪܳ
+    {
+        out[page * 2] = offset & 0xFF;
+        out[page * 2 + 1] = offset >> 8;
+        if (page < canvas->pages)
+            offset += oled_canvas_encode(&canvas->buffer[page * OLED_LIST], &out[offset]);
+    }
+    canvas->packed = out;
+    canvas->buffer = NULL;
+    return total;
+}
+
+/**
+ * @breif   ѹĻѹ
+ * @param   canvas:
+ * @param   buffer:壬pages*OLED_LISTֽ
+ * @retval  
+ */
+void oled_canvas_expand(oled_canvas_t *canvas, uint8_t *buffer)
+{
+    uint8_t page;
+
+    if (canvas->packed == NULL)
+        return;
+    for (page = 0; page < canvas->pages; page++)
+        oled_canvas_page(canvas, page, &buffer[page * OLED_LIST]);
+    canvas->buffer = buffer;
+    canvas->packed = NULL;
+}
+#endif
@@ -0,0 +1,87 @@
+#ifndef __OLED_CANVAS_H_
+#define __OLED_CANVAS_H_
+
+#include "oled.h"
+
+// clang-format off
+/* =========================== û =========================== */
+#define OLED_CANVAS_COMPRESS_EN 1   /* 1-ʹܻRLEѹ洢 0-ر */
+// clang-format on
+
+/* ⻭OLED_LIST߿ɳĻӿΪĻСһ */
+typedef struct
+{
+    uint8_t *buffer;         /* ҳʽpages*OLED_LISTֽڣѹΪNULL */
+#if OLED_CANVAS_COMPRESS_EN
+    const uint8_t *packed;   /* ѹݣNULLʾδѹ */
+#endif
+    uint8_t pages;           /* ҳ OLED_PAGES-OLED_TARGET_PAGES_MAX */
+    uint8_t view_y;          /* ӿʼ */
+} oled_canvas_t;
+
+/* =========================== ⲿ =========================== */
+
+/**
+ * @breif   ʼ
+ * @param   canvas:
+ * @param   buffer:壬pages*OLED_LISTֽڣ128x256Ϊ4KB
+ * @param   pages:ҳ OLED_PAGES-OLED_TARGET_PAGES_MAX
+ * @retval  
+ */
+void oled_canvas_init(oled_canvas_t *canvas, uint8_t *buffer, uint8_t pages);
+
+/**
+ * @breif   ʼڻϻͼ֮oled_show_*oled_draw_*Ⱥд뻭
+ * @param   canvas:δѹ
+ * @note    ԻϽΪԭ㣬пɵpages*8-1浱ǰͼģüΪ
+ * @retval  
+ */
+void oled_canvas_begin(oled_canvas_t *canvas);
+
+/**
+ * @breif   ͼָΪԴϻͼԭͼ
+ * @param   
+ * @retval  
+ */
+void oled_canvas_end(void);
+
+/**
+ * @breif   ƶӿڲѿɼָƵԴ棬»
+ * @param   canvas:
+ * @param   y:ӿʼ 0-pages*8-OLED_HEIGHTʱȡֵ
+ * @note    ӿռoled_flush(oled_swap_buffers)͡
+ *          ϴӿͬΪҶҳʱoled_scroll_verticalʼƽƣ
+ *          ֻƲ¶ҳĻ()֮ƶӦڱػ
+ * @retval  
+ */
+void oled_canvas_view(oled_canvas_t *canvas, uint8_t y);
+
+/**
+ * @breif   ʹ´oled_canvas_viewƣݸıĻݸǺ
+ * @param   
+ * @retval  
+ */
+void oled_canvas_invalidate(void);
+
+#if OLED_CANVAS_COMPRESS_EN
+/**
+ * @breif   ѻѹ洢֮ӿֱӴѹݽ
+ * @param   canvas:δѹ
+ * @param   out:ѹNULLʱֻֽ
+ * @param   size:out
+ * @note    ÿҳoled_show_image_rleĸʽ룬ǰ(pages+1)2ֽڵҳƫƣɰҳ롣
+ *          ɹ󻭲岻ʹãΪһ黭Ļͼ壬黭һͼ壻˵бȴƬհ׵ѹʸ
+ * @retval  ѹֽoutʱ0һ
+ */
+uint16_t oled_canvas_compress(oled_canvas_t *canvas, uint8_t *out, uint16_t size);
+
+/**
+ * @breif   ѹĻѹ壬Աͼ
+ * @param   canvas:ѹ
+ * @param   buffer:壬pages*OLED_LISTֽ
+ * @retval  
+ */
+void oled_canvas_expand(oled_canvas_t *canvas, uint8_t *buffer);
+#endif
+
+#endif
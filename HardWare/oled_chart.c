@@ -0,0 +1,93 @@
+#include "oled_chart.h"
+
+/**
+ * @breif   ֵΪͼڵ
+ * @param   chart:ͼ
+ * @param   value:ֵ
+ * @retval  УԻͼ0Ϊ
+ */
+static uint8_t oled_chart_row(const oled_chart_t *chart, int16_t value)
+{
+    if (chart->max <= chart->min)
+        return chart->height - 1;
+    if (value < chart->min)
+        value = chart->min;
+    if (value > chart->max)
+        value = chart->max;
+    return (uint8_t)(((int32_t)chart->max - value) * (chart->height - 1) / ((int32_t)chart->max - chart->min));
+}
+
+/**
+ * @breif   ʼͼջͼ
+ * @param   chart:ͼ
+ * @param   x:ͼʼ 0-OLED_LIST
+ * @param   y:ͼʼ 0-OLED_HEIGHTҳʱÿֻheight/8ֽ
+ * @param   width:ͼ
+ * @param   height:ͼ߶
+ * @param   min:
+ * @param   max:
+ * @retval  
+ */
+void oled_chart_init(oled_chart_t *chart, uint8_t x, uint8_t y, uint8_t width, uint8_t height, int16_t min, int16_t max)
+{
+    if (x + width > OLED_WIDTH) // ĻʱΪ0
+        width = (x < OLED_WIDTH) ? OLED_WIDTH - x : 0;
+    if (y + height > OLED_HEIGHT)
+        height = (y < OLED_HEIGHT) ? OLED_HEIGHT - y : 0;
+    chart->x = x;
+    chart->y = y;
+    chart->width = width;
+    chart->height = height;
+    chart->min = min;
+    chart->max = max;
+    oled_chart_clear(chart);
+}
+
+/**
+ * @breif   ջͼһпʼ
+ * @param   chart:ͼ
+ * @retval  
+ */
+void oled_chart_clear(oled_chart_t *chart)
+{
+    chart->head = 0;
+    chart->last = 0xFF;
+    oled_clear_area(chart->x, chart->y, chart->width, chart->height);
+}
+
+/**
+ * @breif   һɵһвһ
+ * @param   chart:ͼ
+ * @param   value:ֵʱڱԵ
+ * @retval  
+ */
+void oled_chart_add(oled_chart_t *chart, int16_t value)
+{
+    oled_context_t ctx;
+    uint8_t row, top, bottom;
+    uint8_t x = chart->x + chart->head;
+
+    if (chart->width == 0 || chart->height == 0)
+        return;
+
+    row = oled_chart_row(chart, value);
+    top = row;
+    bottom = row;
+    if (chart->last != 0xFF) // һٱ仯ʱ߲Ͽ
+    {
+        if (chart->last < top)
+            top = chart->last;
+        if (chart->last > bottom)
+            bottom = chart->last;
+    }
+
+    oled_get_context(&ctx); // øǷʽƣûǰͼӰ
+    oled_set_rop(OLED_ROP_COPY);
+    oled_set_clip(chart->x, chart->y, chart->width, chart->height);
+    oled_clear_area(x, chart->y, 1, chart->height);
+    oled_draw_vline(x, chart->y + top, bottom - top + 1);
+    oled_set_context(&ctx);
+
+    chart->last = row;
+    chart->head = (chart->head + 1 < chart->width) ? chart->head + 1 : 0;
+}
@@ -0,0 +1,50 @@
+#ifndef __OLED_CHART_H_
+#define __OLED_CHART_H_
+
+#include "oled.h"
+
+/* ͼͼѭл壬ÿֻдһ */
+typedef struct
+{
+    uint8_t x;      /* ͼʼ */
+    uint8_t y;      /* ͼʼ */
+    uint8_t width;  /* ͼ */
+    uint8_t height; /* ͼ߶ */
+    int16_t min;    /* ޣӦͼ */
+    int16_t max;    /* ޣӦͼ */
+    uint8_t head;   /* һдУԻͼ */
+    uint8_t last;   /* һУԻͼ0xFFʾ */
+} oled_chart_t;
+
+/**
+ * @breif   ʼͼջͼ
+ * @param   chart:ͼ
+ * @param   x:ͼʼ 0-OLED_LIST
+ * @param   y:ͼʼ 0-OLED_HEIGHTҳʱÿֻheight/8ֽ
+ * @param   width:ͼ
+ * @param   height:ͼ߶
+ * @param   min:
+ * @param   max:
+ * @note    ᡢǩڻͼ⣬ʱĶ
+ * @retval  
+ */
+void oled_chart_init(oled_chart_t *chart, uint8_t x, uint8_t y, uint8_t width, uint8_t height, int16_t min, int16_t max);
+
+/**
+ * @breif   һɵһвһ
+ * @param   chart:ͼ
+ * @param   value:ֵʱڱԵ
+ * @note    ֻһΪoled_flush(oled_swap_buffers)
+ *          ҳĵһһheight/8ֽڵĴ䷢
+ * @retval  
+ */
+void oled_chart_add(oled_chart_t *chart, int16_t value);
+
+/**
+ * @breif   ջͼһпʼ
+ * @param   chart:ͼ
+ * @retval  
+ */
+void oled_chart_clear(oled_chart_t *chart);
+
+#endif
@@ -0,0 +1,247 @@
+#include "oled_console.h"
+#include "oled_format.h"
+
+#include "string.h"
+#include "stdarg.h"
+#include "stdio.h"
+
+static char oled_console_text[OLED_CONSOLE_HISTORY][OLED_CONSOLE_COLS_MAX]; /* ع壬ΣδдλΪո */
+static uint8_t oled_console_font;  /* Сֿ */
+static uint8_t oled_console_cols;  /* ÿַ */
+static uint8_t oled_console_rows;  /* Ļ */
+static uint8_t oled_console_pages; /* ÿռõҳ */
+static uint8_t oled_console_head;  /* ǰڻعеλ */
+static uint8_t oled_console_count; /* عеЧ */
+static uint8_t oled_console_row;   /* һеǰڵĻ */
+static uint8_t oled_console_col;   /*  */
+static uint8_t oled_console_view;  /* ǰ0Ϊһ */
+
+/**
+ * @breif   ȡعеһ
+ * @param   back:ǰ֮ǰ0Ϊǰ
+ * @retval  ı
+ */
+static char *oled_console_line(uint8_t back)
+{
+    return oled_console_text[(oled_console_head + OLED_CONSOLE_HISTORY - back) % OLED_CONSOLE_HISTORY];
+}
+
+/**
+ * @breif   Ļϻһַ
+ * @param   row:Ļ
+ * @param   col:
+ * @param   ch:ַոø
+ * @retval  
+ */
+static void oled_console_draw_char(uint8_t row, uint8_t col, char ch)
+{
+    oled_context_t ctx;
+
+    oled_get_context(&ctx); // øǷʽƣûǰͼӰ
+    oled_set_rop(OLED_ROP_COPY);
+    oled_reset_clip();
+    oled_show_char(col * oled_console_font, row * oled_console_pages * 8, ch, oled_console_font);
+    oled_set_context(&ctx);
+}
+
+/**
+ * @breif   ػһĻ
+ * @param   row:Ļ
+ * @param   back:ʾıڵǰ֮ǰЧʱֻ
+ * @retval  
+ */
+static void oled_console_draw_line(uint8_t row, int16_t back)
+{
+    uint8_t col;
+    char *text;
+
+    oled_clear_area(0, row * oled_console_pages * 8, OLED_LIST, oled_console_pages * 8);
+    if (back < 0 || back >= oled_console_count)
+        return;
+    text = oled_console_line(back);
+    for (col = 0; col < oled_console_cols; col++)
+    {
+        if (text[col] != ' ')
+            oled_console_draw_char(row, col, text[col]);
+    }
+}
+
+/**
+ * @breif   ǰλػ
+ * @param   
+ * @retval  
+ */
+static void oled_console_redraw(void)
+{
+    uint8_t row;
+
+    for (row = 0; row < oled_console_rows; row++)
+    {
+        oled_console_draw_line(row, (int16_t)oled_console_row + oled_console_view - row);
+    }
+}
+
+/**
+ * @breif   УĻʱһ
+ * @param   
+ * @retval  
+ */
+static void oled_console_newline(void)
+{
+    oled_console_head = (oled_console_head + 1) % OLED_CONSOLE_HISTORY;
+    memset(oled_console_line(0), ' ', OLED_CONSOLE_COLS_MAX);
+    if (oled_console_count < OLED_CONSOLE_HISTORY)
+        oled_console_count++;
+    oled_console_col = 0;
+
+    if (oled_console_row + 1 < oled_console_rows) // һеǰ¾Ϊ
+        oled_console_row++;
+    else
+        oled_scroll_vertical(oled_console_pages); // ײ¶㣬ػ
+}
+
+/**
+ * @breif   ̨ģʽջع
+ * @param   font_size:С OLED_FONT_6X8/OLED_FONT_7X12/OLED_FONT_8X16
+ * @retval  
+ */
+void oled_console_init(uint8_t font_size)
+{
+    if (font_size != OLED_FONT_7X12 && font_size != OLED_FONT_8X16)
+        font_size = OLED_FONT_6X8;
+    oled_console_font = font_size;
+    oled_console_pages = (font_size == OLED_FONT_6X8) ? 1 : 2; // 7x12ռҳо16
+    oled_console_rows = OLED_PAGES / oled_console_pages;
+    oled_console_cols = OLED_LIST / font_size;
+    if (oled_console_cols > OLED_CONSOLE_COLS_MAX)
+        oled_console_cols = OLED_CONSOLE_COLS_MAX;
+    oled_console_clear();
+}
+
+/**
+ * @breif   ջع壬岻
+ * @param   
+ * @retval  
+ */
+void oled_console_clear(void)
+{
+    memset(oled_console_text, ' ', sizeof(oled_console_text));
+    oled_console_head = 0;
+    oled_console_count = 1;
+    oled_console_row = 0;
+    oled_console_col = 0;
+    oled_console_view = 0;
+    oled_clear_all();
+}
+
+/**
+ * @breif   һַпԶ
+ * @param   ch:ַ֧'\n'С'\r'ס'\b'˸ַ
+ * @retval  
+ */
+void oled_console_putc(char ch)
+{
+    if (oled_console_view != 0) // ڷʷصһ
+    {
+        oled_console_view = 0;
+        oled_console_redraw();
+    }
+
+    if (ch == '\n')
+    {
+        oled_console_newline();
+    }
+    else if (ch == '\r')
+    {
+        oled_console_col = 0;
+    }
+    else if (ch == '\b')
+    {
+        if (oled_console_col > 0)
+        {
+            oled_console_col--;
+            oled_console_line(0)[oled_console_col] = ' ';
+            oled_console_draw_char(oled_console_row, oled_console_col, ' ');
+        }
+    }
+    else if (ch >= ' ' && ch <= '~')
+    {
+        if (oled_console_col >= oled_console_cols) // дһкһַŻУ
+            oled_console_newline();
+        oled_console_line(0)[oled_console_col] = ch;
+        oled_console_draw_char(oled_console_row, oled_console_col, ch);
+        oled_console_col++;
+    }
+}
+
+/**
+ * @breif   ַ
+ * @param   str:ַ
+ * @retval  
+ */
+void oled_console_write(const char *str)
+{
+    while (*str != '\0')
+    {
+        oled_console_putc(*str++);
+    }
+}
+
+/**
+ * @breif   ʽص
+ * @param   arg:δʹ
+ * @param   ch:ַ
+ * @retval  
+ */
+static void oled_console_format_putc(void *arg, char ch)
+{
+    (void)arg;
+    oled_console_putc(ch);
+}
+
+/**
+ * @breif   ʽ
+ * @param   fmt:ʽַ
+ * @retval  
+ */
+void oled_console_printf(const char *fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    oled_vformat(oled_console_format_putc, NULL, fmt, args);
+    va_end(args);
+}
+
+/**
+ * @breif   ع
+ * @param   lines:ǰʷ󣬳Χʱͣڱ߽
+ * @retval  
+ */
+void oled_console_scroll(int8_t lines)
+{
+    int16_t view, delta, max;
+    uint8_t row;
+
+    max = (int16_t)oled_console_count - 1 - oled_console_row; // һеĻΪֹ
+    view = oled_console_view + lines;
+    if (view > max)
+        view = max;
+    if (view < 0)
+        view = 0;
+    delta = view - oled_console_view;
+    if (delta == 0)
+        return;
+    oled_console_view = view;
+
+    if (delta >= oled_console_rows || -delta >= oled_console_rows) // 
+    {
+        oled_console_redraw();
+        return;
+    }
+    oled_scroll_vertical(-delta * oled_console_pages); // ǰʱ
+    for (row = 0; row < oled_console_rows; row++)      // ֻػ¶
+    {
+        if ((delta > 0 && row < delta) || (delta < 0 && row >= oled_console_rows + delta))
+            oled_console_draw_line(row, (int16_t)oled_console_row + oled_console_view - row);
+    }
+}
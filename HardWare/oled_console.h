@@ -0,0 +1,60 @@
+#ifndef __OLED_CONSOLE_H_
+#define __OLED_CONSOLE_H_
+
+#include "oled.h"
+
+// clang-format off
+/* =========================== û =========================== */
+#define OLED_CONSOLE_HISTORY    32  /* ع(ǰ)ÿռOLED_CONSOLE_COLS_MAXֽRAM */
+#define OLED_CONSOLE_COLS_MAX   21  /* ÿַ6x8Ϊ21 */
+#define OLED_CONSOLE_FPUTC_EN   0   /* 1-printfͬʱOLED(Core/Src/usart.cfputcoled_console_putc) 0-ر */
+// clang-format on
+
+/* =========================== ⲿ =========================== */
+
+/**
+ * @breif   ̨ģʽջع
+ * @param   font_size:С OLED_FONT_6X8/OLED_FONT_7X12/OLED_FONT_8X16
+ * @note    ̨ռʱʾʼƣֻػµһ
+ * @retval  
+ */
+void oled_console_init(uint8_t font_size);
+
+/**
+ * @breif   һַпԶ
+ * @param   ch:ַ֧'\n'С'\r'ס'\b'˸ַ
+ * @note    ֻдַڵĸӣˢɵ(oled_flusholed_swap_buffers)
+ * @retval  
+ */
+void oled_console_putc(char ch);
+
+/**
+ * @breif   ַ
+ * @param   str:ַ
+ * @retval  
+ */
+void oled_console_write(const char *str);
+
+/**
+ * @breif   ʽ
+ * @param   fmt:ʽַ
+ * @retval  
+ */
+void oled_console_printf(const char *fmt, ...);
+
+/**
+ * @breif   ع
+ * @param   lines:ǰʷ󣬳Χʱͣڱ߽
+ * @note    ʼй棬ֻػ¶УʱԶصһ
+ * @retval  
+ */
+void oled_console_scroll(int8_t lines);
+
+/**
+ * @breif   ջع壬岻
+ * @param   
+ * @retval  
+ */
+void oled_console_clear(void);
+
+#endif
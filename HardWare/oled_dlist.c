@@ -0,0 +1,250 @@
+#include "oled_dlist.h"
+
+#include "string.h"
+
+#define OLED_DL_CLEAR           0   /*  x y w h */
+#define OLED_DL_RECT            1   /*  x y w h fill */
+#define OLED_DL_LINE            2   /* ֱ x0 y0 x1 y12ֽ */
+#define OLED_DL_TEXT            3   /* ַ x y font ַ... */
+#define OLED_DL_IMAGE           4   /* ͼ x y w h ַ4ֽ */
+
+static oled_dl_ring_t *oled_dl_rings[OLED_DL_RING_MAX]; /* ѵǼǵ */
+static uint8_t oled_dl_ring_count;                      /* ѵǼ */
+
+/**
+ * @breif   Ǽһߵÿͼһʹǰ
+ * @param   ring:Ϊ̬ȫֱ
+ * @retval  0-ɹ 1-ѴOLED_DL_RING_MAX
+ */
+uint8_t oled_dl_register(oled_dl_ring_t *ring)
+{
+    uint8_t error = 1;
+
+    ring->head = 0;
+    ring->tail = 0;
+    ring->dropped = 0;
+    taskENTER_CRITICAL();
+    if (oled_dl_ring_count < OLED_DL_RING_MAX)
+    {
+        oled_dl_rings[oled_dl_ring_count] = ring; // дȾ񲻻ῴָ
+        __DMB();
+        oled_dl_ring_count++;
+        error = 0;
+    }
+    taskEXIT_CRITICAL();
+    return error;
+}
+
+/**
+ * @breif   дһռ䲻ʱ
+ * @param   ring:
+ * @param   type:
+ * @param   param:
+ * @param   len:
+ * @param   extra:(ַ)ڲ֮
+ * @param   extra_len:ݳ
+ * @retval  0-ɹ 1-
+ */
+static uint8_t oled_dl_push(oled_dl_ring_t *ring, uint8_t type, const uint8_t *param, uint8_t len,
+                            const uint8_t *extra, uint8_t extra_len)
+{
+    uint16_t head = ring->head;
+    uint16_t i;
+
+    if ((uint16_t)(head - ring->tail) + 2 + len + extra_len > OLED_DL_RING_SIZE)
+    {
+        ring->dropped++;
+        return 1;
+    }
+    ring->buf[head++ % OLED_DL_RING_SIZE] = type;
+    ring->buf[head++ % OLED_DL_RING_SIZE] = len + extra_len;
+    for (i = 0; i < len; i++)
+        ring->buf[head++ % OLED_DL_RING_SIZE] = param[i];
+    for (i = 0; i < extra_len; i++)
+        ring->buf[head++ % OLED_DL_RING_SIZE] = extra[i];
+    __DMB(); // дŷдλ
+    ring->head = head;
+    return 0;
+}
+
+/**
+ * @breif   ׷
+ * @param   ring:
+ * @param   x: 0-OLED_LIST
+ * @param   y: 0-OLED_HEIGHT
+ * @param   width:
+ * @param   height:߶
+ * @retval  0-ɹ 1-
+ */
+uint8_t oled_dl_clear(oled_dl_ring_t *ring, uint8_t x, uint8_t y, uint8_t width, uint8_t height)
+{
+    uint8_t param[4] = {x, y, width, height};
+    return oled_dl_push(ring, OLED_DL_CLEAR, param, sizeof(param), NULL, 0);
+}
+
+/**
+ * @breif   ׷Ӿ
+ * @param   ring:
+ * @param   x: 0-OLED_LIST
+ * @param   y: 0-OLED_HEIGHT
+ * @param   width:
+ * @param   height:߶
+ * @param   fill:Ƿ 0- 1-
+ * @retval  0-ɹ 1-
+ */
+uint8_t oled_dl_rect(oled_dl_ring_t *ring, uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t fill)
+{
+    uint8_t param[5] = {x, y, width, height, fill};
+    return oled_dl_push(ring, OLED_DL_RECT, param, sizeof(param), NULL, 0);
+}
+
+/**
+ * @breif   ׷ֱ
+ * @param   ring:
+ * @param   x0:УɳĻ
+ * @param   y0:
+ * @param   x1:յ
+ * @param   y1:յ
+ * @retval  0-ɹ 1-
+ */
+uint8_t oled_dl_line(oled_dl_ring_t *ring, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+    int16_t param[4] = {x0, y0, x1, y1};
+    return oled_dl_push(ring, OLED_DL_LINE, (const uint8_t *)param, sizeof(param), NULL, 0);
+}
+
+/**
+ * @breif   ׷ַַƽ
+ * @param   ring:
+ * @param   x: 0-OLED_LIST
+ * @param   y: 0-OLED_HEIGHT
+ * @param   font_size:С
+ * @param   str:ַ֧GBK֣OLED_DL_TEXT_MAXֽڽض
+ * @retval  0-ɹ 1-
+ */
+uint8_t oled_dl_text(oled_dl_ring_t *ring, uint8_t x, uint8_t y, uint8_t font_size, const char *str)
+{
+    uint8_t param[3] = {x, y, font_size};
+    uint8_t len = 0;
+
+    while (str[len] != '\0' && len < OLED_DL_TEXT_MAX)
+        len++;
+    return oled_dl_push(ring, OLED_DL_TEXT, param, sizeof(param), (const uint8_t *)str, len);
+}
+
+/**
+ * @breif   ׷ͼֻ¼ͼַ
+ * @param   ring:
+ * @param   x: 0-OLED_LIST
+ * @param   y: 0-OLED_HEIGHT
+ * @param   image:ͼݣȾǰ뱣ЧһΪconst
+ * @param   width:
+ * @param   height:߶
+ * @retval  0-ɹ 1-
+ */
+uint8_t oled_dl_image(oled_dl_ring_t *ring, uint8_t x, uint8_t y, const uint8_t *image, uint8_t width, uint8_t height)
+{
+    uint8_t param[4 + sizeof(image)] = {x, y, width, height};
+    memcpy(&param[4], &image, sizeof(image));
+    return oled_dl_push(ring, OLED_DL_IMAGE, param, sizeof(param), NULL, 0);
+}
+
+/**
+ * @breif   ִһ
+ * @param   type:
+ * @param   param:ַĩβѲ'\0'
+ * @retval  
+ */
+static void oled_dl_render(uint8_t type, uint8_t *param)
+{
+    int16_t line[4];
+    const uint8_t *image;
+
+    switch (type)
+    {
+    case OLED_DL_CLEAR:
+        oled_clear_area(param[0], param[1], param[2], param[3]);
+        break;
+    case OLED_DL_RECT:
+        oled_draw_rectangle(param[0], param[1], param[2], param[3], param[4]);
+        break;
+    case OLED_DL_LINE:
+        memcpy(line, param, sizeof(line));
+        oled_draw_line(line[0], line[1], line[2], line[3]);
+        break;
+    case OLED_DL_TEXT:
+        oled_show_string(param[0], param[1], &param[3], param[2]);
+        break;
+    case OLED_DL_IMAGE:
+        memcpy(&image, &param[4], sizeof(image));
+        oled_show_image(param[0], param[1], image, param[2], param[3]);
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * @breif   ȡһеȫִ
+ * @param   ring:
+ * @retval  ִе
+ */
+static uint16_t oled_dl_drain(oled_dl_ring_t *ring)
+{
+    uint8_t param[256]; /* 255ֽڣַ */
+    uint16_t tail = ring->tail;
+    uint16_t head = ring->head;
+    uint16_t count = 0;
+    uint8_t type, len, i;
+
+    __DMB(); // ȶдλãٶ
+    while (tail != head)
+    {
+        type = ring->buf[tail++ % OLED_DL_RING_SIZE];
+        len = ring->buf[tail++ % OLED_DL_RING_SIZE];
+        for (i = 0; i < len; i++)
+            param[i] = ring->buf[tail++ % OLED_DL_RING_SIZE];
+        param[len] = '\0';
+        oled_dl_render(type, param);
+        count++;
+    }
+    __DMB(); // ݶͷſռ
+    ring->tail = tail;
+    return count;
+}
+
+/**
+ * @breif   ȾȡԴ沢ˢΨһĻͼ
+ * @param   argument:δʹ
+ * @retval  
+ */
+void oled_dl_task(void *argument)
+{
+    TickType_t wake = xTaskGetTickCount();
+    uint16_t count;
+    uint8_t i;
+
+    (void)argument;
+    for (;;)
+    {
+        vTaskDelayUntil(&wake, pdMS_TO_TICKS(OLED_DL_PERIOD_MS));
+
+        count = 0;
+#if OLED_FRAME_LOCK_EN
+        oled_frame_begin(); // ֱӻͼ񽻴Ҳúϲˢ񽻻֡
+#endif
+        for (i = 0; i < oled_dl_ring_count; i++)
+            count += oled_dl_drain(oled_dl_rings[i]);
+        if (count != 0) // ˢ
+        {
+#if OLED_DOUBLE_BUFFER_EN
+            oled_swap_buffers();
+#else
+            oled_flush();
+#endif
+        }
+#if OLED_FRAME_LOCK_EN
+        oled_frame_end();
+#endif
+    }
+}
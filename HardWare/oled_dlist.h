@@ -0,0 +1,102 @@
+#ifndef __OLED_DLIST_H_
+#define __OLED_DLIST_H_
+
+#include "oled.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+// clang-format off
+/* =========================== û =========================== */
+#define OLED_DL_RING_SIZE       256 /* ÿߵֽΪ2 */
+#define OLED_DL_RING_MAX        4   /*  */
+#define OLED_DL_PERIOD_MS       20  /* ȾȾˢڣλms */
+#define OLED_DL_TEXT_MAX        64  /* ַֽ */
+// clang-format on
+
+/* =========================== ⲿ =========================== */
+
+/* ߵռдˣȾռˣ */
+typedef struct
+{
+    uint8_t buf[OLED_DL_RING_SIZE]; /* ¼͡ȡ */
+    volatile uint16_t head;         /* дλãֻ޸ģɵ */
+    volatile uint16_t tail;         /* λãֻȾ޸ģɵ */
+    uint16_t dropped;               /*  */
+} oled_dl_ring_t;
+
+/**
+ * @breif   Ǽһߵÿͼһʹǰ
+ * @param   ring:Ϊ̬ȫֱ
+ * @retval  0-ɹ 1-ѴOLED_DL_RING_MAX
+ */
+uint8_t oled_dl_register(oled_dl_ring_t *ring);
+
+/**
+ * @breif   ׷
+ * @param   ring:
+ * @param   x: 0-OLED_LIST
+ * @param   y: 0-OLED_HEIGHT
+ * @param   width:
+ * @param   height:߶
+ * @retval  0-ɹ 1-
+ */
+uint8_t oled_dl_clear(oled_dl_ring_t *ring, uint8_t x, uint8_t y, uint8_t width, uint8_t height);
+
+/**
+ * @breif   ׷Ӿ
+ * @param   ring:
+ * @param   x: 0-OLED_LIST
+ * @param   y: 0-OLED_HEIGHT
+ * @param   width:
+ * @param   height:߶
+ * @param   fill:Ƿ 0- 1-
+ * @retval  0-ɹ 1-
+ */
+uint8_t oled_dl_rect(oled_dl_ring_t *ring, uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t fill);
+
+/**
+ * @breif   ׷ֱ
+ * @param   ring:
+ * @param   x0:УɳĻ
+ * @param   y0:
+ * @param   x1:յ
+ * @param   y1:յ
+ * @retval  0-ɹ 1-
+ */
+uint8_t oled_dl_line(oled_dl_ring_t *ring, int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
+/**
+ * @breif   ׷ַַƽ
+ * @param   ring:
+ * @param   x: 0-OLED_LIST
+ * @param   y: 0-OLED_HEIGHT
+ * @param   font_size:С
+ * @param   str:ַ֧GBK֣OLED_DL_TEXT_MAXֽڽض
+ * @retval  0-ɹ 1-
+ */
+uint8_t oled_dl_text(oled_dl_ring_t *ring, uint8_t x, uint8_t y, uint8_t font_size, const char *str);
+
+/**
+ * @breif   ׷ͼֻ¼ͼַ
+ * @param   ring:
+ * @param   x: 0-OLED_LIST
+ * @param   y: 0-OLED_HEIGHT
+ * @param   image:ͼݣȾǰ뱣ЧһΪconst
+ * @param   width:
+ * @param   height:߶
+ * @retval  0-ɹ 1-
+ */
+uint8_t oled_dl_image(oled_dl_ring_t *ring, uint8_t x, uint8_t y, const uint8_t *image, uint8_t width, uint8_t height);
+
+/**
+ * @breif   ȾȡԴ沢ˢΨһĻͼ
+ * @param   argument:δʹ
+ * @note    ˫ʱͨoled_swap_buffersoled_display_taskֱͣoled_flush
+ *          ԶʹʱӦMX_FREERTOS_Initдջ256(1KB)
+ *          256ֽڻ壬ͼԼ200ֽڡ
+ *          Ⱦ뽻ڼ֡(oled_frame_begin)ֱӻͼʱͬ֡סһ֡ͳ֡
+ * @retval  
+ */
+void oled_dl_task(void *argument);
+
+#endif
@@ -0,0 +1,94 @@
+#include "oled_field.h"
+
+#include "string.h"
+
+/**
+ * @breif   ʼֿ´oled_field_setʱ
+ * @param   field:ֿ
+ * @param   x: 0-OLED_LIST
+ * @param   y: 0-OLED_HEIGHT
+ * @param   font_size:С
+ * @param   width:ַ 1-OLED_FIELD_MAX
+ * @param   decimals:Сλ0Ϊwidth-2
+ * @param   zero_pad:1-λ0 0-ո
+ * @retval  
+ */
+void oled_field_init(oled_field_t *field, uint8_t x, uint8_t y, uint8_t font_size, uint8_t width, uint8_t decimals,
+                     uint8_t zero_pad)
+{
+    if (width > OLED_FIELD_MAX)
+        width = OLED_FIELD_MAX;
+    if (decimals + 2 > width) // λС
+        decimals = (width > 2) ? width - 2 : 0;
+    field->x = x;
+    field->y = y;
+    field->font_size = font_size;
+    field->width = width;
+    field->decimals = decimals;
+    field->zero_pad = zero_pad;
+    oled_field_invalidate(field);
+}
+
+/**
+ * @breif   ʾ¼´oled_field_setʱػ
+ * @param   field:ֿ
+ * @retval  
+ */
+void oled_field_invalidate(oled_field_t *field)
+{
+    memset(field->text, 0, sizeof(field->text));
+}
+
+/**
+ * @breif   ʾֵֻػϴβַͬҲֻЩΪ
+ * @param   field:ֿ
+ * @param   value:ֵСλʱΪ
+ * @retval  
+ */
+void oled_field_set(oled_field_t *field, int32_t value)
+{
+    char text[OLED_FIELD_MAX];
+    char digits[OLED_FIELD_MAX]; /* С㣬 */
+    oled_context_t ctx;
+    uint32_t abs_value = (value < 0) ? 0U - (uint32_t)value : (uint32_t)value;
+    uint8_t len = 0, count = 0, i = 0;
+
+    /* Ӹλλɣĸλ */
+    while ((abs_value != 0 || count <= field->decimals) && len + (count == field->decimals && count != 0) < OLED_FIELD_MAX)
+    {
+        if (count == field->decimals && count != 0)
+            digits[len++] = '.';
+        digits[len++] = '0' + abs_value % 10;
+        abs_value /= 10;
+        count++;
+    }
+
+    if (abs_value != 0 || count <= field->decimals || len + (value < 0) > field->width) // λ
+    {
+        memset(text, '#', field->width);
+    }
+    else
+    {
+        if (value < 0 && field->zero_pad) // 0ʱ
+            text[i++] = '-';
+        while (i < field->width - len - (value < 0 && !field->zero_pad))
+            text[i++] = field->zero_pad ? '0' : ' ';
+        if (value < 0 && !field->zero_pad)
+            text[i++] = '-';
+        while (len > 0)
+            text[i++] = digits[--len];
+    }
+
+    oled_get_context(&ctx); // øǷʽƣոø
+    oled_set_rop(OLED_ROP_COPY);
+    oled_reset_clip();
+    for (i = 0; i < field->width; i++)
+    {
+        if (text[i] != field->text[i])
+        {
+            oled_show_char(field->x + i * field->font_size, field->y, text[i], field->font_size);
+            field->text[i] = text[i];
+        }
+    }
+    oled_set_context(&ctx);
+}
@@ -0,0 +1,50 @@
+#ifndef __OLED_FIELD_H_
+#define __OLED_FIELD_H_
+
+#include "oled.h"
+
+#define OLED_FIELD_MAX          12  /* ַֿ(źС) */
+
+/* ֿ򣬼סʾַʱֻػ仯ַ */
+typedef struct
+{
+    uint8_t x;                   /* ʼ */
+    uint8_t y;                   /* ʼ */
+    uint8_t font_size;           /* С */
+    uint8_t width;               /* ֵַҶ */
+    uint8_t decimals;            /* Сλֵ10^decimalsŵĶ */
+    uint8_t zero_pad;            /* 1-λ0 0-ո */
+    char text[OLED_FIELD_MAX];   /* Ļʾַ0ʾδ֪´αػ */
+} oled_field_t;
+
+/**
+ * @breif   ʼֿ´oled_field_setʱ
+ * @param   field:ֿ
+ * @param   x: 0-OLED_LIST
+ * @param   y: 0-OLED_HEIGHT
+ * @param   font_size:С
+ * @param   width:ַ 1-OLED_FIELD_MAX
+ * @param   decimals:Сλ0Ϊwidth-2ʱȡwidth-2
+ * @param   zero_pad:1-λ0 0-ո
+ * @retval  
+ */
+void oled_field_init(oled_field_t *field, uint8_t x, uint8_t y, uint8_t font_size, uint8_t width, uint8_t decimals,
+                     uint8_t zero_pad);
+
+/**
+ * @breif   ʾֵֻػϴβַͬҲֻЩΪ
+ * @param   field:ֿ
+ * @param   value:ֵСλʱΪdecimalsΪ1ʱ235ʾ23.5
+ * @note    λʱʾ'#'
+ * @retval  
+ */
+void oled_field_set(oled_field_t *field, int32_t value);
+
+/**
+ * @breif   ʾ¼´oled_field_setʱػ(类ݸǺ)
+ * @param   field:ֿ
+ * @retval  
+ */
+void oled_field_invalidate(oled_field_t *field);
+
+#endif
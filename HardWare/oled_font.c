@@ -308,35 +308,37 @@ const uint8_t oled_font_8x16[][16] = {
 /*12أ12 GBK/GB2312*/
 const OLED_Character_t oled_Cfont_12x12[] = {
 
-"",{0x00,0x08,0xD2,0x00,0xDE,0x5A,0xDA,0xDA,0x5A,0x5E,0xC0,0x00,0x00,0x07,0x00,0x04,0x07,0x04,0x07,0x07,0x04,0x04,0x07,0x00},/*"",0*/
+"",{0x00,0x10,0xA6,0xAC,0xA0,0xA0,0x9F,0xA0,0xA8,0xA6,0xE2,0x00,0x00,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x07,0x00},/*"",0*/
 "",{0x00,0xC0,0x3C,0x94,0x94,0xBC,0xD3,0xD4,0xBC,0x14,0x12,0x00,0x00,0x07,0x04,0x04,0x04,0x05,0x02,0x02,0x05,0x04,0x04,0x00},/*"",1*/
-"",{0x00,0x10,0xA6,0xAC,0xA0,0xA0,0x9F,0xA0,0xA8,0xA6,0xE2,0x00,0x00,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x07,0x00},/*"",2*/
-"ǰ",{0x04,0xE4,0x54,0x55,0x56,0xF4,0x04,0xF4,0x07,0xF4,0x04,0x04,0x00,0x07,0x01,0x01,0x05,0x07,0x00,0x01,0x04,0x07,0x00,0x00},/*"ǰ",3*/
-"Ԥ",{0x00,0x02,0xFA,0x26,0x62,0x02,0xFA,0x8E,0x6A,0x0A,0xFA,0x00,0x00,0x04,0x07,0x00,0x00,0x04,0x05,0x03,0x02,0x02,0x04,0x00},/*"Ԥ",4*/
-"",{0x00,0x10,0xF2,0x00,0x30,0x6E,0xA2,0x22,0xBE,0x70,0x10,0x00,0x00,0x00,0x07,0x07,0x05,0x04,0x03,0x03,0x03,0x04,0x04,0x00},/*"",5*/
-"ʪ",{0x00,0x53,0xA2,0x44,0xBE,0x2A,0xEA,0x2A,0xEA,0x2A,0xFE,0x00,0x00,0x07,0x00,0x04,0x05,0x04,0x07,0x04,0x07,0x06,0x05,0x00},/*"ʪ",6*/
-    /*ĸʽλüµĺ*/
+"ǰ",{0x04,0xE4,0x54,0x55,0x56,0xF4,0x04,0xF4,0x07,0xF4,0x04,0x04,0x00,0x07,0x01,0x01,0x05,0x07,0x00,0x01,0x04,0x07,0x00,0x00},/*"ǰ",2*/
+"",{0x00,0x10,0xF2,0x00,0x30,0x6E,0xA2,0x22,0xBE,0x70,0x10,0x00,0x00,0x00,0x07,0x07,0x05,0x04,0x03,0x03,0x03,0x04,0x04,0x00},/*"",3*/
+"ʪ",{0x00,0x53,0xA2,0x44,0xBE,0x2A,0xEA,0x2A,0xEA,0x2A,0xFE,0x00,0x00,0x07,0x00,0x04,0x05,0x04,0x07,0x04,0x07,0x06,0x05,0x00},/*"ʪ",4*/
+"",{0x00,0x08,0xD2,0x00,0xDE,0x5A,0xDA,0xDA,0x5A,0x5E,0xC0,0x00,0x00,0x07,0x00,0x04,0x07,0x04,0x07,0x07,0x04,0x04,0x07,0x00},/*"",5*/
+"Ԥ",{0x00,0x02,0xFA,0x26,0x62,0x02,0xFA,0x8E,0x6A,0x0A,0xFA,0x00,0x00,0x04,0x07,0x00,0x00,0x04,0x05,0x03,0x02,0x02,0x04,0x00},/*"Ԥ",6*/
+    /*ĸʽµĺݣ밴GBKСУʱʹöַ*/
 
     /*δַ֪ ڼʺ*/
     "",
     {0x00, 0xFE, 0x02, 0x32, 0x0A, 0x0A, 0x8A, 0x4A, 0x32, 0x02, 0xFE, 0x00, 0x00, 0x07, 0x04, 0x04, 0x04, 0x04, 0x06, 0x04, 0x04, 0x04, 0x07, 0x00}, /*"Ĭ",x*/
 };
+const uint16_t oled_Cfont_12x12_count = sizeof(oled_Cfont_12x12) / sizeof(oled_Cfont_12x12[0]) - 1; /* δַ֪ */
 
 /*16أ16 GBK/GB2312*/
 const OLED_Character_t oled_Cfont_16x16[] = {
 
-    "",
-    {0x00, 0x80, 0x60, 0xF8, 0x07, 0x40, 0x20, 0x18, 0x0F, 0x08, 0xC8, 0x08, 0x08, 0x28, 0x18, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x10, 0x0C, 0x03, 0x40, 0x80, 0x7F, 0x00, 0x01, 0x06, 0x18, 0x00}, /*"",0*/
     "",
-    {0x10, 0x10, 0xF0, 0x1F, 0x10, 0xF0, 0x00, 0x80, 0x82, 0x82, 0xE2, 0x92, 0x8A, 0x86, 0x80, 0x00, 0x40, 0x22, 0x15, 0x08, 0x16, 0x61, 0x00, 0x00, 0x40, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"",1*/
-    "",
-    {0x20, 0x20, 0x20, 0xFE, 0x20, 0x20, 0xFF, 0x20, 0x20, 0x20, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x40, 0x47, 0x44, 0x44, 0x44, 0x47, 0x40, 0x40, 0x40, 0x00, 0x00}, /*"",2*/
+    {0x10, 0x10, 0xF0, 0x1F, 0x10, 0xF0, 0x00, 0x80, 0x82, 0x82, 0xE2, 0x92, 0x8A, 0x86, 0x80, 0x00, 0x40, 0x22, 0x15, 0x08, 0x16, 0x61, 0x00, 0x00, 0x40, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"",0*/
     "",
-    {0x00, 0x00, 0x00, 0xFE, 0x92, 0x92, 0x92, 0xFE, 0x92, 0x92, 0x92, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x04, 0x84, 0x62, 0x1E, 0x01, 0x00, 0x01, 0xFE, 0x02, 0x04, 0x04, 0x08, 0x08, 0x00}, /*"",3*/
+    {0x00, 0x00, 0x00, 0xFE, 0x92, 0x92, 0x92, 0xFE, 0x92, 0x92, 0x92, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x04, 0x84, 0x62, 0x1E, 0x01, 0x00, 0x01, 0xFE, 0x02, 0x04, 0x04, 0x08, 0x08, 0x00}, /*"",1*/
+    "",
+    {0x00, 0x80, 0x60, 0xF8, 0x07, 0x40, 0x20, 0x18, 0x0F, 0x08, 0xC8, 0x08, 0x08, 0x28, 0x18, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x10, 0x0C, 0x03, 0x40, 0x80, 0x7F, 0x00, 0x01, 0x06, 0x18, 0x00}, /*"",2*/
+    "",
+    {0x20, 0x20, 0x20, 0xFE, 0x20, 0x20, 0xFF, 0x20, 0x20, 0x20, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x40, 0x47, 0x44, 0x44, 0x44, 0x47, 0x40, 0x40, 0x40, 0x00, 0x00}, /*"",3*/
 
-    /*ĸʽλüµĺ*/
+    /*ĸʽµĺݣ밴GBKСУʱʹöַ*/
 
     /*δַ֪ ڼʺ*/
     "",
     {0x00, 0xFE, 0x02, 0x02, 0x72, 0x1A, 0x0A, 0x0A, 0x0A, 0x8A, 0x72, 0x02, 0x02, 0x02, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x57, 0x40, 0x40, 0x40, 0x40, 0x40, 0x7F, 0x00}, /*"Ĭ",x*/
 };
+const uint16_t oled_Cfont_16x16_count = sizeof(oled_Cfont_16x16) / sizeof(oled_Cfont_16x16[0]) - 1; /* δַ֪ */
@@ -9,11 +9,29 @@ typedef struct
     uint8_t Data[32];
 } OLED_Character_t;
 
+#define OLED_FORMAT_RAW    0 /* ҳʽδѹ */
+#define OLED_FORMAT_RLE    1 /* ÿģRLEѹʽoled_show_image_rle */
+#define OLED_FORMAT_PACKED 2 /* ÿģλţʽoled_show_image_packed */
+
+/* ֿ(Tools/oled_fontc.py)ɵֿ⣬ģOLEDҳʽ */
+typedef struct
+{
+    uint8_t height;         /* ָ */
+    uint16_t count;         /* ַĩβδַ֪ */
+    const uint16_t *code;   /* 룬СУASCIIΪֽڣΪGBK˫ֽ(ֽǰ) */
+    const uint8_t *width;   /* ַȣcount+1 */
+    const uint16_t *offset; /* ַģbitmapеʼλãcount+1 */
+    const uint8_t *bitmap;  /* ģҳУÿҳwidthֽ */
+    uint8_t format;         /* ģʽ OLED_FORMAT_RAW/RLE/PACKED */
+} oled_font_t;
+
 extern const uint8_t oled_font_6x8[][6];
 extern const uint8_t oled_font_7x12[][14];
 extern const uint8_t oled_font_8x16[][16];
 
 extern const OLED_Character_t oled_Cfont_12x12[];
 extern const OLED_Character_t oled_Cfont_16x16[];
+extern const uint16_t oled_Cfont_12x12_count;
+extern const uint16_t oled_Cfont_16x16_count;
 
 #endif
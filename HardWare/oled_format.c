@@ -0,0 +1,344 @@
+#include "oled_format.h"
+
+#define OLED_FMT_LEFT           0x01 /* '-'  */
+#define OLED_FMT_ZERO           0x02 /* '0' 0 */
+#define OLED_FMT_PLUS           0x04 /* '+' '+' */
+#define OLED_FMT_SPACE          0x08 /* ' ' ӿո */
+#define OLED_FMT_ALT            0x10 /* '#' 16Ƽ0x80ͷ%fС */
+
+typedef struct
+{
+    oled_putc_t putc; /* ַص */
+    void *arg;        /* ص */
+    uint16_t count;   /* ַ */
+} oled_format_out_t;
+
+static const uint32_t oled_pow10[10] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000,
+};
+
+/**
+ * @breif   һַ
+ * @param   out:
+ * @param   ch:ַ
+ * @retval  
+ */
+static void oled_format_put(oled_format_out_t *out, char ch)
+{
+    out->putc(out->arg, ch);
+    out->count++;
+}
+
+/**
+ * @breif   ظһַ
+ * @param   out:
+ * @param   ch:ַ
+ * @param   n:Сڵ0
+ * @retval  
+ */
+static void oled_format_repeat(oled_format_out_t *out, char ch, int16_t n)
+{
+    while (n-- > 0)
+        oled_format_put(out, ch);
+}
+
+/**
+ * @breif   
+ * @param   out:
+ * @param   value:ֵ
+ * @param   base: 81016
+ * @param   upper:16Ƿд
+ * @param   prefix:Żǰ׺"-""0x"""ʾ
+ * @param   flags:OLED_FMT_LEFT/OLED_FMT_ZERO/OLED_FMT_ALT(8ʱ0ͷ)
+ * @param   width:С
+ * @param   prec:λ-1ʾδָ
+ * @retval  
+ */
+static void oled_format_number(oled_format_out_t *out, uint32_t value, uint8_t base, uint8_t upper, const char *prefix,
+                               uint8_t flags, int16_t width, int16_t prec)
+{
+    char digits[11]; /* 32λ811λ */
+    const char *table = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+    int16_t len = 0, zeros, pad, prefix_len = 0;
+
+    for (; value != 0; value /= base)
+        digits[len++] = table[value % base];
+    if (len == 0 && prec != 0) // 0һλΪ0ʱ
+        digits[len++] = '0';
+
+    while (prefix[prefix_len] != '\0')
+        prefix_len++;
+    zeros = (prec > len) ? prec - len : 0;
+    if (base == 8 && (flags & OLED_FMT_ALT) && zeros == 0 && (len == 0 || digits[len - 1] != '0')) // λΪ0
+        zeros = 1;
+    pad = width - len - zeros - prefix_len;
+    if ((flags & OLED_FMT_ZERO) && !(flags & OLED_FMT_LEFT) && prec < 0) // 0ڷ֮
+    {
+        zeros += (pad > 0) ? pad : 0;
+        pad = 0;
+    }
+
+    if (!(flags & OLED_FMT_LEFT))
+        oled_format_repeat(out, ' ', pad);
+    while (*prefix != '\0')
+        oled_format_put(out, *prefix++);
+    oled_format_repeat(out, '0', zeros);
+    while (len > 0)
+        oled_format_put(out, digits[--len]);
+    if (flags & OLED_FMT_LEFT)
+        oled_format_repeat(out, ' ', pad);
+}
+
+/**
+ * @breif   ַ
+ * @param   out:
+ * @param   str:ַNULL"(null)"
+ * @param   flags:OLED_FMT_LEFT
+ * @param   width:С
+ * @param   prec:ַ-1ʾ
+ * @retval  
+ */
+static void oled_format_string(oled_format_out_t *out, const char *str, uint8_t flags, int16_t width, int16_t prec)
+{
+    int16_t len = 0;
+
+    if (str == 0)
+        str = "(null)";
+    while (str[len] != '\0' && (prec < 0 || len < prec))
+        len++;
+
+    if (!(flags & OLED_FMT_LEFT))
+        oled_format_repeat(out, ' ', width - len);
+    for (prec = 0; prec < len; prec++)
+        oled_format_put(out, str[prec]);
+    if (flags & OLED_FMT_LEFT)
+        oled_format_repeat(out, ' ', width - len);
+}
+
+/**
+ * @breif   С
+ * @param   out:
+ * @param   value:ֵ
+ * @param   sign:ķţ""ʾ
+ * @param   flags:OLED_FMT_LEFT/OLED_FMT_ZERO/OLED_FMT_ALT
+ * @param   width:С
+ * @param   prec:Сλ 0-9-1ʾĬ6λ
+ * @note    СתΪ96λλ10ֵȷ룬ǡһʱȡżCһ
+ * @retval  
+ */
+static void oled_format_fixed(oled_format_out_t *out, double value, const char *sign, uint8_t flags, int16_t width,
+                              int16_t prec)
+{
+    union
+    {
+        double f;
+        uint64_t u;
+    } bits;
+    uint32_t rest[3] = {0, 0, 0}; /* Сֵ96λrest[0]Ϊλ */
+    uint64_t product;
+    double part;
+    uint32_t ipart, frac = 0, carry;
+    uint16_t start = out->count;
+    uint8_t i, j, point;
+
+    if (prec < 0)
+        prec = 6;
+    if (prec > 9)
+        prec = 9;
+    bits.f = value;
+    if (bits.u >> 63) // ÷λжϣ-0.0Ҳ'-'
+    {
+        value = -value;
+        sign = "-";
+    }
+    if (!(value < 4294967295.0)) // 32λNaN
+    {
+        oled_format_string(out, "ovf", flags, width, -1);
+        return;
+    }
+
+    ipart = (uint32_t)value;
+    part = value - ipart;
+    if (part >= 1.0 / 2147483648.0) // С2^-31ʱ9λȫΪ0Ҳһ룬0
+    {
+        for (j = 0; j < 3; j++) // ÿγ2^32ȡ32λ˷Χڵdouble96λû
+        {
+            part *= 4294967296.0;
+            rest[j] = (uint32_t)part;
+            part -= rest[j];
+        }
+    }
+    for (i = 0; i < prec; i++) // λ10ȡСrestĲ
+    {
+        carry = 0;
+        for (j = 3; j-- > 0;)
+        {
+            product = (uint64_t)rest[j] * 10 + carry;
+            rest[j] = (uint32_t)product;
+            carry = (uint32_t)(product >> 32);
+        }
+        frac = frac * 10 + carry;
+    }
+    if (rest[0] > 0x80000000U ||
+        (rest[0] == 0x80000000U && ((rest[1] | rest[2]) != 0 || ((prec ? frac : ipart) & 1)))) // ǡһʱȡż
+    {
+        if (prec == 0 || ++frac >= oled_pow10[prec]) // λ
+        {
+            frac = 0;
+            ipart++;
+        }
+    }
+
+    /* ֳеҶĲ룬С̶ֹprecλ */
+    point = (prec > 0 || (flags & OLED_FMT_ALT)) ? 1 : 0;
+    oled_format_number(out, ipart, 10, 0, sign, flags & OLED_FMT_ZERO,
+                       (flags & OLED_FMT_LEFT) ? 0 : width - prec - point, -1);
+    if (point)
+        oled_format_put(out, '.');
+    if (prec > 0)
+        oled_format_number(out, frac, 10, 0, "", 0, 0, prec);
+    if (flags & OLED_FMT_LEFT)
+        oled_format_repeat(out, ' ', width - (int16_t)(out->count - start));
+}
+
+/**
+ * @breif   ʽַصַ壬ڴvsnprintf
+ * @param   putc:ַص
+ * @param   arg:ص
+ * @param   fmt:ʽַ
+ * @param   args:б
+ * @retval  ַ
+ */
+uint16_t oled_vformat(oled_putc_t putc, void *arg, const char *fmt, va_list args)
+{
+    oled_format_out_t out;
+    uint8_t flags;
+    int16_t width, prec;
+    int32_t value;
+    uint32_t number;
+    uint8_t longs;
+    const char *sign;
+
+    out.putc = putc;
+    out.arg = arg;
+    out.count = 0;
+
+    for (; *fmt != '\0'; fmt++)
+    {
+        if (*fmt != '%')
+        {
+            oled_format_put(&out, *fmt);
+            continue;
+        }
+
+        flags = 0;
+        for (;;) // ־
+        {
+            fmt++;
+            if (*fmt == '-')
+                flags |= OLED_FMT_LEFT;
+            else if (*fmt == '0')
+                flags |= OLED_FMT_ZERO;
+            else if (*fmt == '+')
+                flags |= OLED_FMT_PLUS;
+            else if (*fmt == ' ')
+                flags |= OLED_FMT_SPACE;
+            else if (*fmt == '#')
+                flags |= OLED_FMT_ALT;
+            else
+                break;
+        }
+
+        width = 0; // 
+        if (*fmt == '*')
+        {
+            width = va_arg(args, int);
+            if (width < 0)
+            {
+                flags |= OLED_FMT_LEFT;
+                width = -width;
+            }
+            fmt++;
+        }
+        for (; *fmt >= '0' && *fmt <= '9'; fmt++)
+            width = width * 10 + (*fmt - '0');
+
+        prec = -1; // 
+        if (*fmt == '.')
+        {
+            fmt++;
+            prec = 0;
+            if (*fmt == '*')
+            {
+                prec = va_arg(args, int);
+                fmt++;
+            }
+            for (; *fmt >= '0' && *fmt <= '9'; fmt++)
+                prec = prec * 10 + (*fmt - '0');
+        }
+
+        longs = 0; // intlongͬΪ32λllȡ64λ
+        for (; *fmt == 'l' || *fmt == 'h' || *fmt == 'z' || *fmt == 'j' || *fmt == 't'; fmt++)
+        {
+            if (*fmt == 'l' || *fmt == 'j')
+                longs++;
+        }
+
+        sign = (flags & OLED_FMT_PLUS) ? "+" : ((flags & OLED_FMT_SPACE) ? " " : "");
+        switch (*fmt)
+        {
+        case 'd':
+        case 'i':
+            value = (longs >= 2) ? (int32_t)va_arg(args, long long) : va_arg(args, int);
+            if (value < 0)
+                oled_format_number(&out, 0U - (uint32_t)value, 10, 0, "-", flags, width, prec);
+            else
+                oled_format_number(&out, (uint32_t)value, 10, 0, sign, flags, width, prec);
+            break;
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+            number = (longs >= 2) ? (uint32_t)va_arg(args, unsigned long long) : va_arg(args, unsigned int);
+            if (*fmt == 'u' || *fmt == 'o')
+                oled_format_number(&out, number, (*fmt == 'u') ? 10 : 8, 0, "", flags, width, prec);
+            else
+                oled_format_number(&out, number, 16, *fmt == 'X',
+                                   ((flags & OLED_FMT_ALT) && number != 0) ? ((*fmt == 'X') ? "0X" : "0x") : "", flags,
+                                   width, prec);
+            break;
+        case 'p':
+            oled_format_number(&out, (uint32_t)(uintptr_t)va_arg(args, void *), 16, 0, "0x", OLED_FMT_ZERO, 10, -1);
+            break;
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+            oled_format_fixed(&out, va_arg(args, double), sign, flags, width, prec);
+            break;
+        case 'c':
+            if (!(flags & OLED_FMT_LEFT))
+                oled_format_repeat(&out, ' ', width - 1);
+            oled_format_put(&out, (char)va_arg(args, int));
+            if (flags & OLED_FMT_LEFT)
+                oled_format_repeat(&out, ' ', width - 1);
+            break;
+        case 's':
+            oled_format_string(&out, va_arg(args, const char *), flags, width, prec);
+            break;
+        case '%':
+            oled_format_put(&out, '%');
+            break;
+        case 'n':
+            (void)va_arg(args, int *); // дַֻ
+            break;
+        case '\0': // ʽ'%'β
+            return out.count;
+        default: // ֵ֧תδ֪޷
+            break;
+        }
+    }
+    return out.count;
+}
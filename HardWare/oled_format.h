@@ -0,0 +1,24 @@
+#ifndef __OLED_FORMAT_H_
+#define __OLED_FORMAT_H_
+
+#include "stdint.h"
+#include "stdarg.h"
+
+typedef void (*oled_putc_t)(void *arg, char ch); /* ַصargΪߵ */
+
+/**
+ * @breif   ʽַصַ壬ڴvsnprintf
+ * @param   putc:ַص
+ * @param   arg:ص
+ * @param   fmt:ʽַ֧%d %i %u %o %x %X %c %s %p %f %%
+ *              ־- 0 + ո #뾫(*)l h z j tд32λ
+ * @param   args:б
+ * @note    ·Χvsnprintfַһ(oled_sim -f)CĲ֮ͬ
+ *          %fCͬ(ȷֵǡһʱȡż)9λ
+ *          ֳ32λNaNʱ"ovf"%e %g%f
+ *          %lld64λֻ32λ%nдֵ֧ת
+ * @retval  ַ
+ */
+uint16_t oled_vformat(oled_putc_t putc, void *arg, const char *fmt, va_list args);
+
+#endif
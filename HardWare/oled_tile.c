@@ -0,0 +1,317 @@
+#include "oled_tile.h"
+
+#include "string.h"
+
+#define OLED_TILE_SLOTS         (OLED_TILE_COLS + 1) /* ˮƽƫƲ8ıʱÿҳһ */
+
+typedef struct
+{
+    const uint8_t *image; /* ͼ */
+    const uint8_t *mask;  /* 룬NULLΪͼ */
+    uint8_t width;        /*  */
+    uint8_t height;       /* ߶ */
+    uint8_t x;            /*  */
+    uint8_t y;            /*  */
+    uint8_t visible;      /* Ƿʾ */
+} oled_sprite_t;
+
+static const uint8_t *oled_tile_data; /* ͼ鼯 */
+static uint8_t *oled_tile_map;        /* ͼͼ */
+static uint8_t oled_tile_map_width;   /* ͼ() */
+static uint8_t oled_tile_map_height;  /* ͼ߶() */
+static uint8_t oled_tile_col;         /* ĻӦĵͼ */
+static uint8_t oled_tile_fine;        /* ˮƽƫƵĿ 0-7 */
+static uint8_t oled_tile_row;         /* ĻҳӦĵͼ */
+
+static uint16_t oled_tile_shown[OLED_PAGES][OLED_TILE_SLOTS]; /* ÿλϴκϳɵͼţ0xFFFFΪЧ */
+static uint16_t oled_tile_dirty[OLED_PAGES];                  /* ÿҳϳɵĸbit nΪn */
+
+static oled_sprite_t oled_sprite[OLED_SPRITE_MAX];       /* ĵǰ */
+static oled_sprite_t oled_sprite_drawn[OLED_SPRITE_MAX]; /* ϴκϳʱ */
+
+/**
+ * @breif   ʹĿλʧЧ
+ * @param   
+ * @retval  
+ */
+static void oled_tile_invalidate(void)
+{
+    memset(oled_tile_shown, 0xFF, sizeof(oled_tile_shown));
+}
+
+/**
+ * @breif   һθǵĸ
+ * @param   x:
+ * @param   y:
+ * @param   width:
+ * @param   height:߶
+ * @retval  
+ */
+static void oled_tile_mark(uint8_t x, uint8_t y, uint8_t width, uint8_t height)
+{
+    uint16_t x_end = x + width, y_end = y + height;
+    uint16_t bits;
+    uint8_t page;
+
+    if (width == 0 || height == 0 || x >= OLED_LIST || y >= OLED_HEIGHT)
+        return;
+    if (x_end > OLED_LIST)
+        x_end = OLED_LIST;
+    if (y_end > OLED_HEIGHT)
+        y_end = OLED_HEIGHT;
+
+    bits = (uint16_t)(((1UL << ((x_end + 7) / 8)) - 1) & ~((1UL << (x / 8)) - 1));
+    for (page = y / 8; page < (y_end + 7) / 8; page++)
+        oled_tile_dirty[page] |= bits;
+}
+
+/**
+ * @breif   ȽÿλǰͼϴκϳʱǷͬͬǵĸ
+ * @param   
+ * @retval  
+ */
+static void oled_tile_scan(void)
+{
+    const uint8_t *line;
+    uint8_t page, slot, col;
+    uint16_t index;
+
+    for (page = 0; page < OLED_PAGES; page++)
+    {
+        line = &oled_tile_map[((oled_tile_row + page) % oled_tile_map_height) * oled_tile_map_width];
+        col = oled_tile_col;
+        for (slot = 0; slot < OLED_TILE_SLOTS; slot++)
+        {
+            index = line[col];
+            if (++col >= oled_tile_map_width)
+                col = 0;
+            if (index == oled_tile_shown[page][slot])
+                continue;
+            oled_tile_shown[page][slot] = index;
+            if (oled_tile_fine == 0) // 룬һλĻ
+            {
+                if (slot < OLED_TILE_COLS)
+                    oled_tile_dirty[page] |= 1U << slot;
+            }
+            else // λ
+            {
+                if (slot > 0)
+                    oled_tile_dirty[page] |= 1U << (slot - 1);
+                if (slot < OLED_TILE_COLS)
+                    oled_tile_dirty[page] |= 1U << slot;
+            }
+        }
+    }
+}
+
+/**
+ * @breif   ȽϾ
+ * @param   a:a
+ * @param   b:b
+ * @retval  0-ͬ 1-ͬ
+ */
+static uint8_t oled_sprite_changed(const oled_sprite_t *a, const oled_sprite_t *b)
+{
+    return a->image != b->image || a->mask != b->mask || a->width != b->width || a->height != b->height ||
+           a->x != b->x || a->y != b->y || a->visible != b->visible;
+}
+
+/**
+ * @breif   ϳһҳɸ
+ * @param   page:ҳ
+ * @param   cell:ʼ
+ * @param   count:
+ * @retval  
+ */
+static void oled_tile_compose(uint8_t page, uint8_t cell, uint8_t count)
+{
+    const oled_sprite_t *sprite;
+    const uint8_t *line;
+    uint8_t x = cell * 8, width = count * 8, y = page * 8;
+    uint8_t slot, col, i;
+    int16_t left;
+
+    oled_set_clip(x, y, width, 8);
+
+    /* ͼ㣬ҳ룬oled_show_image˻Ϊҳ */
+    oled_set_rop(OLED_ROP_COPY);
+    line = &oled_tile_map[((oled_tile_row + page) % oled_tile_map_height) * oled_tile_map_width];
+    slot = (x + oled_tile_fine) / 8;
+    col = (oled_tile_col + slot) % oled_tile_map_width;
+    for (; slot < OLED_TILE_SLOTS; slot++)
+    {
+        left = slot * 8 - oled_tile_fine;
+        if (left >= x + width)
+            break;
+        if (left < 0) // ֻ¶Ҳಿ
+            oled_show_image(0, y, &oled_tile_data[line[col] * 8 - left], 8 + left, 8);
+        else
+            oled_show_image(left, y, &oled_tile_data[line[col] * 8], 8, 8);
+        if (++col >= oled_tile_map_width)
+            col = 0;
+    }
+
+    /* 㣬Ŵӵ͵ߵ */
+    for (i = 0; i < OLED_SPRITE_MAX; i++)
+    {
+        sprite = &oled_sprite_drawn[i];
+        if (!sprite->visible || sprite->x >= x + width || sprite->x + sprite->width <= x || sprite->y >= y + 8 ||
+            sprite->y + sprite->height <= y)
+            continue;
+        if (sprite->mask != NULL)
+        {
+            oled_set_rop(OLED_ROP_ANDNOT); // ڵĵ
+            oled_show_image(sprite->x, sprite->y, sprite->mask, sprite->width, sprite->height);
+        }
+        oled_set_rop(OLED_ROP_OR);
+        oled_show_image(sprite->x, sprite->y, sprite->image, sprite->width, sprite->height);
+    }
+}
+
+/**
+ * @breif   ͼ㣬´oled_tile_renderʱϳ
+ * @param   tiles:ͼ鼯
+ * @param   map:ͼͼ
+ * @param   map_width:ͼ()
+ * @param   map_height:ͼ߶()
+ * @retval  
+ */
+void oled_tile_init(const uint8_t *tiles, uint8_t *map, uint8_t map_width, uint8_t map_height)
+{
+    oled_tile_data = tiles;
+    oled_tile_map = map;
+    oled_tile_map_width = map_width;
+    oled_tile_map_height = map_height;
+    oled_tile_col = 0;
+    oled_tile_fine = 0;
+    oled_tile_row = 0;
+    oled_tile_invalidate();
+}
+
+/**
+ * @breif   ޸ĵͼеһͼ
+ * @param   col:ͼ()
+ * @param   row:ͼ()
+ * @param   index:ͼ
+ * @retval  
+ */
+void oled_tile_set(uint8_t col, uint8_t row, uint8_t index)
+{
+    if (oled_tile_map == NULL || col >= oled_tile_map_width || row >= oled_tile_map_height)
+        return;
+    oled_tile_map[row * oled_tile_map_width + col] = index;
+}
+
+/**
+ * @breif   ͼλ
+ * @param   x:ˮƽƫ()
+ * @param   row:ֱƫ()
+ * @retval  
+ */
+void oled_tile_scroll(uint16_t x, uint8_t row)
+{
+    uint8_t col, fine;
+
+    if (oled_tile_map == NULL)
+        return;
+    col = (x / 8) % oled_tile_map_width;
+    fine = x % 8;
+    row %= oled_tile_map_height;
+    if (col == oled_tile_col && fine == oled_tile_fine && row == oled_tile_row)
+        return;
+    oled_tile_col = col;
+    oled_tile_fine = fine;
+    oled_tile_row = row;
+    oled_tile_invalidate(); // λƶһȽϱ
+}
+
+/**
+ * @breif   ʾһ
+ * @param   id:
+ * @param   image:ͼ
+ * @param   mask:룬NULLʾͼΪ0ĵ͸
+ * @param   width:
+ * @param   height:߶
+ * @param   x:
+ * @param   y:
+ * @retval  
+ */
+void oled_sprite_show(uint8_t id, const uint8_t *image, const uint8_t *mask, uint8_t width, uint8_t height, uint8_t x,
+                      uint8_t y)
+{
+    oled_sprite_t *sprite;
+
+    if (id >= OLED_SPRITE_MAX)
+        return;
+    sprite = &oled_sprite[id];
+    sprite->image = image;
+    sprite->mask = mask;
+    sprite->width = width;
+    sprite->height = height;
+    sprite->x = x;
+    sprite->y = y;
+    sprite->visible = 1;
+}
+
+/**
+ * @breif   ؾ
+ * @param   id:
+ * @retval  
+ */
+void oled_sprite_hide(uint8_t id)
+{
+    if (id >= OLED_SPRITE_MAX)
+        return;
+    oled_sprite[id].visible = 0;
+}
+
+/**
+ * @breif   ѱ仯ĻºϳɵԴ沢
+ * @param   
+ * @retval  
+ */
+void oled_tile_render(void)
+{
+    oled_sprite_t *sprite, *drawn;
+    oled_context_t ctx;
+    uint8_t i, page, cell, count;
+    uint16_t bits;
+
+    if (oled_tile_map == NULL)
+        return;
+
+    oled_tile_scan();
+    for (i = 0; i < OLED_SPRITE_MAX; i++) // 仯ʱλλöҪºϳ
+    {
+        sprite = &oled_sprite[i];
+        drawn = &oled_sprite_drawn[i];
+        if ((!sprite->visible && !drawn->visible) || !oled_sprite_changed(sprite, drawn))
+            continue;
+        if (drawn->visible)
+            oled_tile_mark(drawn->x, drawn->y, drawn->width, drawn->height);
+        if (sprite->visible)
+            oled_tile_mark(sprite->x, sprite->y, sprite->width, sprite->height);
+        *drawn = *sprite;
+    }
+
+    oled_get_context(&ctx); // ϳù̶Ĺդüԭû
+    for (page = 0; page < OLED_PAGES; page++)
+    {
+        bits = oled_tile_dirty[page];
+        oled_tile_dirty[page] = 0;
+        cell = 0;
+        while (bits)
+        {
+            while (!(bits & 1)) // δ仯ĸ
+            {
+                bits >>= 1;
+                cell++;
+            }
+            for (count = 0; bits & 1; count++) // ڵı仯ϲΪһ
+                bits >>= 1;
+            oled_tile_compose(page, cell, count);
+            cell += count;
+        }
+    }
+    oled_set_context(&ctx);
+}
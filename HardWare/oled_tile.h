@@ -0,0 +1,77 @@
+#ifndef __OLED_TILE_H_
+#define __OLED_TILE_H_
+
+#include "oled.h"
+
+// clang-format off
+/* =========================== û =========================== */
+#define OLED_SPRITE_MAX         8   /* ԽԽϲ */
+// clang-format on
+
+#define OLED_TILE_COLS          (OLED_LIST / 8) /* Ļÿҳ8x8 */
+
+/* =========================== ⲿ =========================== */
+
+/**
+ * @breif   ͼ㣬´oled_tile_renderʱϳ
+ * @param   tiles:ͼ鼯ÿ8x8ռ8ֽ(ҳʽÿֽһУbit0)ntiles[n*8]ʼ
+ *                һ8n x 8ͼƬTools/oled_imgc.pyתΪ˸ʽ
+ * @param   map:ͼͼmap[row*map_width+col]Ϊͼţoled_tile_set޸
+ * @param   map_width:ͼ() 1-255
+ * @param   map_height:ͼ߶() 1-255
+ * @note    ͼѭƴӣֻƣͼ
+ * @retval  
+ */
+void oled_tile_init(const uint8_t *tiles, uint8_t *map, uint8_t map_width, uint8_t map_height);
+
+/**
+ * @breif   ޸ĵͼеһͼ
+ * @param   col:ͼ()
+ * @param   row:ͼ()
+ * @param   index:ͼ
+ * @note    ֻ¼޸ģoled_tile_renderʱȽÿĻʾıţֻºϳɱ仯ĸ
+ * @retval  
+ */
+void oled_tile_set(uint8_t col, uint8_t row, uint8_t index);
+
+/**
+ * @breif   ͼλ
+ * @param   x:ˮƽƫ()ֵƬΪֽڿ
+ * @param   row:ֱƫ()ҳͼ鲻λ
+ * @note    λøıºϳ
+ * @retval  
+ */
+void oled_tile_scroll(uint16_t x, uint8_t row);
+
+/**
+ * @breif   ʾһ
+ * @param   id: 0-OLED_SPRITE_MAX-1Ŵ߸ǱС
+ * @param   image:ͼҳʽͬoled_show_image
+ * @param   mask:룬ʽߴͬͼΪ1ĵʾ顢Ϊ0ĵ͸²㣻NULLʾͼΪ0ĵ͸
+ * @param   width:
+ * @param   height:߶
+ * @param   x: 0-OLED_LISTĻֲʾ
+ * @param   y: 0-OLED_HEIGHT
+ * @note    ͼΪ0λΪ0ֻ֡贫µͼ/룬λûݲʱػ
+ * @retval  
+ */
+void oled_sprite_show(uint8_t id, const uint8_t *image, const uint8_t *mask, uint8_t width, uint8_t height, uint8_t x,
+                      uint8_t y);
+
+/**
+ * @breif   ؾ飬ԭλ´oled_tile_renderʱָΪͼ
+ * @param   id:
+ * @retval  
+ */
+void oled_sprite_hide(uint8_t id);
+
+/**
+ * @breif   ѱ仯ĻºϳɵԴ沢
+ * @param   
+ * @note    ͼŸı䡢صľƶ/֡/ʱøȿͼٰŵӾ飻
+ *          ͬһҳڵĸϲoled_flush(oled_swap_buffers)
+ * @retval  
+ */
+void oled_tile_render(void);
+
+#endif
@@ -0,0 +1,284 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+OLED字库编译器
+
+把BDF或TTF/OTF字体按指定字号栅格化，只取需要的字符，生成oled_show_text可直接使用的
+const C表。字模已是SSD1306页格式(按页排列，每页width字节，bit0为本页最上一行)，
+设备端不再做位序转换。
+
+用法:
+    python Tools/oled_fontc.py simsun.ttc --size 12 --ascii --chars "温度湿度当前预设" \\
+        -o HardWare/oled_font_12.c --name oled_font_12
+    python Tools/oled_fontc.py wenquanyi_12pt.bdf --charset menu.txt --ascii -o HardWare/oled_font_menu.c
+
+    TTF需要Pillow(pip install pillow)，BDF不需要任何第三方库。
+
+输出(<name>为--name):
+    <name>_bitmap   字模数据
+    <name>_code     编码，从小到大排列，ASCII为单字节，其余为--encoding(默认GBK)双字节，高字节在前
+    <name>_width    字宽，等宽字体用--width指定，否则取字体的步进宽度
+    <name>_offset   各字模在bitmap中的起始位置
+    <name>          oled_font_t描述符
+    --compress rle     每个字模单独RLE压缩(格式见oled_show_image_rle)
+    --compress packed  每个字模按列紧排height位(格式见oled_show_image_packed)，字高非8的倍数时更省
+    两种格式设备端都是边解码边写显存，不需要解压缓冲。
+    末尾附加一个方框字模作为未知字符，不计入count。同时生成同名.h声明描述符。
+"""
+
+import argparse
+import os
+import sys
+
+ASCII_CHARS = "".join(chr(c) for c in range(0x20, 0x7F))
+
+
+def load_bdf(path):
+    """解析BDF，返回(ascent, descent, {字符: (步进宽度, (宽, 高, x偏移, y偏移), 行数据)})"""
+    glyphs = {}
+    ascent = descent = None
+    bbox = None
+    with open(path, "r", encoding="latin-1") as f:
+        lines = iter(f.read().splitlines())
+    for line in lines:
+        parts = line.split()
+        if not parts:
+            continue
+        key = parts[0]
+        if key == "FONTBOUNDINGBOX":
+            bbox = [int(v) for v in parts[1:5]]
+        elif key == "FONT_ASCENT":
+            ascent = int(parts[1])
+        elif key == "FONT_DESCENT":
+            descent = int(parts[1])
+        elif key == "STARTCHAR":
+            encoding, dwidth, bbx, rows = -1, 0, (0, 0, 0, 0), []
+            for line in lines:
+                parts = line.split()
+                if not parts:
+                    continue
+                if parts[0] == "ENCODING":
+                    encoding = int(parts[1])
+                elif parts[0] == "DWIDTH":
+                    dwidth = int(parts[1])
+                elif parts[0] == "BBX":
+                    bbx = tuple(int(v) for v in parts[1:5])
+                elif parts[0] == "BITMAP":
+                    for line in lines:
+                        if line.strip() == "ENDCHAR":
+                            break
+                        rows.append(int(line.strip(), 16))
+                    break
+            if encoding >= 0:
+                glyphs[chr(encoding)] = (dwidth or bbx[0], bbx, rows)
+    if ascent is None or descent is None:
+        if bbox is None:
+            sys.exit("%s: 缺少FONT_ASCENT/FONT_DESCENT与FONTBOUNDINGBOX" % path)
+        ascent, descent = bbox[1] + bbox[3], -bbox[3]
+    return ascent, descent, glyphs
+
+
+def raster_bdf(path, chars, height, width, y_offset):
+    """按BDF栅格化，返回{字符: (宽, 像素集合)}"""
+    ascent, descent, glyphs = load_bdf(path)
+    height = height or ascent + descent
+    top = ascent + (height - ascent - descent) // 2 + y_offset  # 基线所在行
+    out = {}
+    for ch in chars:
+        if ch not in glyphs:
+            print("警告: 字体中没有 %r，跳过" % ch, file=sys.stderr)
+            continue
+        dwidth, (bw, bh, bx, by), rows = glyphs[ch]
+        w = width or dwidth
+        pad = (bw + 7) // 8 * 8
+        pixels = set()
+        for r, bits in enumerate(rows):
+            y = top - (by + bh) + r
+            for c in range(bw):
+                if bits & (1 << (pad - 1 - c)):
+                    x = bx + c
+                    if 0 <= x < w and 0 <= y < height:
+                        pixels.add((x, y))
+        out[ch] = (w, pixels)
+    return height, out
+
+
+def raster_ttf(path, chars, size, height, width, y_offset, threshold):
+    """按TTF/OTF栅格化，返回{字符: (宽, 像素集合)}"""
+    try:
+        from PIL import Image, ImageDraw, ImageFont
+    except ImportError:
+        sys.exit("栅格化TTF需要Pillow: pip install pillow")
+    font = ImageFont.truetype(path, size)
+    ascent, descent = font.getmetrics()
+    height = height or ascent + descent
+    top = (height - ascent - descent) // 2 + y_offset
+    out = {}
+    for ch in chars:
+        w = width or max(1, int(round(font.getlength(ch))))
+        img = Image.new("L", (w, height), 0)
+        ImageDraw.Draw(img).text((0, top), ch, font=font, fill=255)
+        data = img.load()
+        pixels = set((x, y) for y in range(height) for x in range(w) if data[x, y] >= threshold)
+        out[ch] = (w, pixels)
+    return height, out
+
+
+def pack_pages(w, height, pixels):
+    """像素集合转换为OLED页格式字节"""
+    data = []
+    for page in range((height + 7) // 8):
+        for x in range(w):
+            byte = 0
+            for bit in range(8):
+                if (x, page * 8 + bit) in pixels:
+                    byte |= 1 << bit
+            data.append(byte)
+    return data
+
+
+def pack_bits(w, height, pixels):
+    """按列紧排：每列height位，低位在上，列与列之间不补齐"""
+    out, acc, n = [], 0, 0
+    for x in range(w):
+        for y in range(height):
+            if (x, y) in pixels:
+                acc |= 1 << n
+            n += 1
+            if n == 8:
+                out.append(acc)
+                acc, n = 0, 0
+    if n:
+        out.append(acc)
+    return out
+
+
+def rle_encode(data):
+    """RLE压缩：控制字节c<0x80后跟c+1个原样字节，c>=0x80后跟1个字节重复(c&0x7F)+3次"""
+    out, literal, i = [], [], 0
+
+    def flush():
+        while literal:
+            chunk = literal[:128]
+            del literal[:128]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and data[i + run] == data[i] and run < 130:
+            run += 1
+        if run >= 3:
+            flush()
+            out.extend([0x80 | (run - 3), data[i]])
+            i += run
+        else:
+            literal.append(data[i])
+            i += 1
+    flush()
+    return out
+
+
+def char_code(ch, encoding):
+    if ord(ch) < 0x80:
+        return ord(ch)
+    raw = ch.encode(encoding)
+    if len(raw) != 2:
+        sys.exit("%r 在%s中不是双字节编码" % (ch, encoding))
+    return (raw[0] << 8) | raw[1]
+
+
+def emit(out_path, name, height, glyphs, encoding, source, compress):
+    entries = sorted(((char_code(ch, encoding), ch) + glyphs[ch] for ch in glyphs), key=lambda e: e[0])
+    for a, b in zip(entries, entries[1:]):
+        if a[0] == b[0]:
+            sys.exit("编码重复: %r %r" % (a[1], b[1]))
+
+    # 未知字符：与最宽字符同宽的方框
+    box_w = max([e[2] for e in entries] + [3])
+    box = set((x, y) for x in range(box_w - 1) for y in range(height) if x in (0, box_w - 2) or y in (0, height - 1))
+    entries.append((None, None, box_w, box))
+
+    bitmap, offsets, lines, raw_size = [], [], [], 0
+    for index, (code, ch, w, pixels) in enumerate(entries):
+        data = pack_pages(w, height, pixels)
+        raw_size += len(data)
+        if compress == "rle":
+            data = rle_encode(data)
+        elif compress == "packed":
+            data = pack_bits(w, height, pixels)
+        offsets.append(len(bitmap))
+        bitmap.extend(data)
+        label = '"%s"' % ch if ch is not None else '"未知"'
+        lines.append("    %s /*%s,%d*/" % (" ".join("0x%02X," % b for b in data), label, index))
+    if len(bitmap) > 0xFFFF:
+        sys.exit("字模共%d字节，超过offset表的16位范围，请减少字符" % len(bitmap))
+    count = len(entries) - 1
+
+    def table(values, fmt, per_line):
+        rows = []
+        for i in range(0, len(values), per_line):
+            rows.append("    " + " ".join(fmt % v + "," for v in values[i:i + per_line]))
+        return "\n".join(rows)
+
+    header = os.path.splitext(os.path.basename(out_path))[0] + ".h"
+    with open(out_path, "w", encoding=encoding, newline="\n") as f:
+        f.write('#include "%s"\n\n' % header)
+        f.write("/*\n由Tools/oled_fontc.py生成，请勿手工修改\n")
+        f.write("字体 %s  字高%d  %d个字符  字模%d字节" % (os.path.basename(source), height, count, len(bitmap)))
+        f.write("(%s，原%d字节)\n" % (compress, raw_size) if compress != "none" else "\n")
+        f.write("文件格式 %s\n*/\n\n" % encoding.upper())
+        f.write("static const uint8_t %s_bitmap[] = {\n%s\n};\n\n" % (name, "\n".join(lines)))
+        f.write("static const uint16_t %s_code[] = {\n%s\n};\n\n" % (name, table([e[0] for e in entries[:-1]], "0x%04X", 12)))
+        f.write("static const uint8_t %s_width[] = {\n%s\n};\n\n" % (name, table([e[2] for e in entries], "%d", 16)))
+        f.write("static const uint16_t %s_offset[] = {\n%s\n};\n\n" % (name, table(offsets, "%d", 12)))
+        f.write("const oled_font_t %s = {%d, %d, %s_code, %s_width, %s_offset, %s_bitmap, %s};\n"
+                % (name, height, count, name, name, name, name, "OLED_FORMAT_" + {"none": "RAW", "rle": "RLE", "packed": "PACKED"}[compress]))
+
+    guard = "__%s_H_" % header[:-2].upper()
+    with open(os.path.join(os.path.dirname(out_path) or ".", header), "w", encoding="ascii", newline="\n") as f:
+        f.write("#ifndef %s\n#define %s\n\n#include \"oled_font.h\"\n\n" % (guard, guard))
+        f.write("extern const oled_font_t %s;\n\n#endif\n" % name)
+    print("%s: %d个字符，字模%d字节(未压缩%d字节)，表%d字节" % (out_path, count, len(bitmap), raw_size, count * 2 + (count + 1) * 3))
+
+
+def main():
+    ap = argparse.ArgumentParser(description="把BDF/TTF字体编译为OLED页格式字库")
+    ap.add_argument("font", help="BDF或TTF/OTF/TTC字体文件")
+    ap.add_argument("-o", "--output", required=True, help="输出的.c文件，同目录生成同名.h")
+    ap.add_argument("--name", help="描述符变量名，默认取输出文件名")
+    ap.add_argument("--size", type=int, default=12, help="TTF字号(像素)，默认12")
+    ap.add_argument("--height", type=int, help="字高，默认取字体的ascent+descent")
+    ap.add_argument("--width", type=int, help="等宽字宽，默认取各字符的步进宽度")
+    ap.add_argument("--y-offset", type=int, default=0, help="基线上下微调，正数向下")
+    ap.add_argument("--threshold", type=int, default=128, help="TTF灰度阈值 0-255，默认128")
+    ap.add_argument("--ascii", action="store_true", help="加入可打印ASCII(0x20-0x7E)")
+    ap.add_argument("--chars", default="", help="要加入的字符")
+    ap.add_argument("--charset", help="字符集文本文件(UTF-8)，文件中出现的字符都会加入，空白除外")
+    ap.add_argument("--encoding", default="gbk", help="非ASCII字符的编码，默认gbk")
+    ap.add_argument("--compress", choices=["none", "rle", "packed"], default="none", help="字模压缩方式，默认none")
+    args = ap.parse_args()
+
+    chars = args.chars
+    if args.charset:
+        with open(args.charset, "r", encoding="utf-8") as f:
+            chars += "".join(f.read().split())
+    if args.ascii:
+        chars += ASCII_CHARS
+    chars = "".join(sorted(set(chars)))
+    if not chars:
+        sys.exit("没有字符，请用--ascii/--chars/--charset指定")
+
+    if args.font.lower().endswith(".bdf"):
+        height, glyphs = raster_bdf(args.font, chars, args.height, args.width, args.y_offset)
+    else:
+        height, glyphs = raster_ttf(args.font, chars, args.size, args.height, args.width, args.y_offset, args.threshold)
+    if height > 64:
+        sys.exit("字高%d超过屏幕高度" % height)
+
+    name = args.name or os.path.splitext(os.path.basename(args.output))[0]
+    emit(args.output, name, height, glyphs, args.encoding, args.font, args.compress)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+OLED图像转换工具
+
+把PBM(P1/P4)或其他图片(需Pillow)转换为oled_show_image使用的页格式数组，
+--compress rle输出oled_show_image_rle使用的RLE压缩数组，
+--compress packed输出oled_show_image_packed使用的按列紧排数组。
+
+用法:
+    python Tools/oled_imgc.py logo.png --compress rle --name logo_rle > logo.c
+    python Tools/oled_imgc.py logo.pbm --invert
+"""
+
+import argparse
+import os
+import sys
+
+from oled_fontc import pack_bits, pack_pages, rle_encode
+
+
+def read_pbm(path):
+    """读取PBM，返回(宽, 高, 像素集合)，1为黑"""
+    with open(path, "rb") as f:
+        raw = f.read()
+    tokens, pos = [], 0
+    while len(tokens) < 3:  # 魔数、宽、高，跳过注释
+        while raw[pos:pos + 1].isspace():
+            pos += 1
+        if raw[pos:pos + 1] == b"#":
+            pos = raw.index(b"\n", pos)
+            continue
+        end = pos
+        while not raw[end:end + 1].isspace():
+            end += 1
+        tokens.append(raw[pos:end])
+        pos = end
+    magic, w, h = tokens[0], int(tokens[1]), int(tokens[2])
+    pixels = set()
+    if magic == b"P4":
+        pos += 1
+        stride = (w + 7) // 8
+        for y in range(h):
+            for x in range(w):
+                if raw[pos + y * stride + x // 8] & (0x80 >> (x % 8)):
+                    pixels.add((x, y))
+    elif magic == b"P1":
+        bits = [c for c in raw[pos:].decode("ascii") if c in "01"]
+        for i, c in enumerate(bits[:w * h]):
+            if c == "1":
+                pixels.add((i % w, i // w))
+    else:
+        return None
+    return w, h, pixels
+
+
+def read_image(path, threshold):
+    """读取图片，返回(宽, 高, 像素集合)，亮于阈值的点为1"""
+    try:
+        from PIL import Image
+    except ImportError:
+        sys.exit("非PBM图片需要Pillow: pip install pillow")
+    img = Image.open(path).convert("L")
+    data = img.load()
+    w, h = img.size
+    return w, h, set((x, y) for y in range(h) for x in range(w) if data[x, y] >= threshold)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="把图片转换为OLED页格式数组")
+    ap.add_argument("image", help="PBM或其他图片")
+    ap.add_argument("--name", help="数组名，默认取文件名")
+    ap.add_argument("--threshold", type=int, default=128, help="灰度阈值 0-255，默认128")
+    ap.add_argument("--invert", action="store_true", help="反色")
+    ap.add_argument("--compress", choices=["none", "rle", "packed"], default="none", help="压缩方式，默认none")
+    args = ap.parse_args()
+
+    img = read_pbm(args.image) if args.image.lower().endswith(".pbm") else None
+    w, h, pixels = img or read_image(args.image, args.threshold)
+    if w > 128 or h > 64:
+        sys.exit("图片%dx%d超过屏幕大小" % (w, h))
+    if args.invert:
+        pixels = set((x, y) for y in range(h) for x in range(w)) - pixels
+
+    data = pack_pages(w, h, pixels)
+    raw_size = len(data)
+    if args.compress == "rle":
+        data = rle_encode(data)
+    elif args.compress == "packed":
+        data = pack_bits(w, h, pixels)
+    name = args.name or os.path.splitext(os.path.basename(args.image))[0]
+
+    if args.compress == "none":
+        print("/*宽%d像素，高%d像素 %d字节*/" % (w, h, len(data)))
+    else:
+        print("/*宽%d像素，高%d像素 %s %d字节，原%d字节*/" % (w, h, args.compress, len(data), raw_size))
+    print("const uint8_t %s[] = {" % name)
+    for i in range(0, len(data), 16):
+        print("    " + " ".join("0x%02X," % b for b in data[i:i + 16]))
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
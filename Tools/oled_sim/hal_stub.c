@@ -0,0 +1,219 @@
+#include "oled.h"
+#include "oled_emu.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "stdlib.h"
+#include "string.h"
+
+/* 主机编译用的HAL与FreeRTOS替身，总线写入转交SSD1306模拟器，DMA传输立即完成 */
+
+static GPIO_TypeDef oled_sim_gpio[3];
+GPIO_TypeDef *GPIOA = &oled_sim_gpio[0];
+GPIO_TypeDef *GPIOB = &oled_sim_gpio[1];
+GPIO_TypeDef *GPIOC = &oled_sim_gpio[2];
+
+static TickType_t oled_sim_tick; /* 模拟的系统节拍，只在延时时前进 */
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+    if (PinState == GPIO_PIN_SET)
+        GPIOx->odr |= GPIO_Pin;
+    else
+        GPIOx->odr &= ~(uint32_t)GPIO_Pin;
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+    oled_sim_tick += Delay;
+}
+
+uint32_t HAL_GetTick(void)
+{
+    return oled_sim_tick;
+}
+
+#if OLED_I2C_EN
+I2C_HandleTypeDef hi2c1;
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                    uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+    (void)hi2c;
+    (void)DevAddress;
+    (void)MemAddSize;
+    (void)Timeout;
+    oled_emu_write(MemAddress == 0x40, pData, Size, 1); // 控制字节0x40为数据，0x00为命令
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                        uint16_t MemAddSize, uint8_t *pData, uint16_t Size)
+{
+    HAL_I2C_Mem_Write(hi2c, DevAddress, MemAddress, MemAddSize, pData, Size, 0);
+#if OLED_ASYNC_EN
+    HAL_I2C_MemTxCpltCallback(hi2c); // 递归推进下一步，深度不超过区段数的两倍
+#endif
+    return HAL_OK;
+}
+#endif
+
+#if OLED_SPI_EN
+SPI_HandleTypeDef hspi2;
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+    (void)hspi;
+    (void)Timeout;
+    oled_emu_write((OLED_DC_PORT->odr & OLED_DC_PIN) != 0, pData, Size, 0);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size)
+{
+    HAL_SPI_Transmit(hspi, pData, Size, 0);
+#if OLED_ASYNC_EN
+    HAL_SPI_TxCpltCallback(hspi);
+#endif
+    return HAL_OK;
+}
+#endif
+
+void vTaskDelay(const TickType_t xTicksToDelay)
+{
+    oled_sim_tick += xTicksToDelay;
+}
+
+void vTaskDelayUntil(TickType_t *const pxPreviousWakeTime, const TickType_t xTimeIncrement)
+{
+    *pxPreviousWakeTime += xTimeIncrement;
+    if ((int32_t)(*pxPreviousWakeTime - oled_sim_tick) > 0)
+        oled_sim_tick = *pxPreviousWakeTime;
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return oled_sim_tick;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return NULL;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t xTaskToNotify)
+{
+    (void)xTaskToNotify;
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t xTaskToNotify, BaseType_t *pxHigherPriorityTaskWoken)
+{
+    (void)xTaskToNotify;
+    *pxHigherPriorityTaskWoken = pdFALSE;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t xClearCountOnExit, TickType_t xTicksToWait)
+{
+    (void)xClearCountOnExit;
+    (void)xTicksToWait;
+    return 1;
+}
+
+BaseType_t xTaskGetSchedulerState(void)
+{
+    return taskSCHEDULER_RUNNING;
+}
+
+#if OLED_ASYNC_EN || OLED_FRAME_LOCK_EN
+SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t *pxSemaphoreBuffer)
+{
+    pxSemaphoreBuffer->count = 0;
+    return pxSemaphoreBuffer;
+}
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutexStatic(StaticSemaphore_t *pxMutexBuffer)
+{
+    pxMutexBuffer->count = 0; // 单线程下只记录嵌套层数
+    return pxMutexBuffer;
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t xMutex, TickType_t xBlockTime)
+{
+    (void)xBlockTime;
+    xMutex->count++;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t xMutex)
+{
+    if (xMutex->count == 0)
+        return pdFALSE;
+    xMutex->count--;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t xSemaphore, TickType_t xBlockTime)
+{
+    (void)xBlockTime;
+    if (xSemaphore->count == 0) // 单线程下没有其他任务来释放
+        return pdFALSE;
+    xSemaphore->count = 0;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t xSemaphore)
+{
+    xSemaphore->count = 1;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t xSemaphore, BaseType_t *pxHigherPriorityTaskWoken)
+{
+    *pxHigherPriorityTaskWoken = pdFALSE;
+    return xSemaphoreGive(xSemaphore);
+}
+#endif
+
+#if OLED_FONT_GBK_EN
+const char *oled_sim_fatfs_path(const TCHAR *path)
+{
+    static char host[256];
+    const char *root = getenv("OLED_SIM_FATFS");
+    const char *name = strrchr(path, '/');
+
+    snprintf(host, sizeof(host), "%s/%s", root != NULL ? root : "/tmp", name != NULL ? name + 1 : path);
+    return host;
+}
+
+FRESULT f_open(FIL *fp, const TCHAR *path, BYTE mode)
+{
+    (void)mode; // 只支持只读
+    fp->fp = fopen(oled_sim_fatfs_path(path), "rb");
+    return fp->fp != NULL ? FR_OK : FR_NO_FILE;
+}
+
+FRESULT f_close(FIL *fp)
+{
+    if (fp->fp == NULL)
+        return FR_INVALID_OBJECT;
+    fclose(fp->fp);
+    fp->fp = NULL;
+    return FR_OK;
+}
+
+FRESULT f_lseek(FIL *fp, FSIZE_t ofs)
+{
+    if (fp->fp == NULL)
+        return FR_INVALID_OBJECT;
+    return fseek(fp->fp, (long)ofs, SEEK_SET) == 0 ? FR_OK : FR_DISK_ERR;
+}
+
+FRESULT f_read(FIL *fp, void *buff, UINT btr, UINT *br)
+{
+    if (fp->fp == NULL)
+        return FR_INVALID_OBJECT;
+    *br = (UINT)fread(buff, 1, btr, fp->fp);
+    return ferror(fp->fp) ? FR_DISK_ERR : FR_OK;
+}
+#endif
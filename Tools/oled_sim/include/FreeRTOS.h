@@ -0,0 +1,23 @@
+#ifndef INC_FREERTOS_H
+#define INC_FREERTOS_H
+
+/* 主机编译用的FreeRTOS替身，单线程运行，临界区为空 */
+#include "stdint.h"
+#include "stddef.h"
+
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE                 ((BaseType_t)0)
+#define pdTRUE                  ((BaseType_t)1)
+#define pdPASS                  pdTRUE
+#define portMAX_DELAY           ((TickType_t)0xFFFFFFFFUL)
+#define configTICK_RATE_HZ      ((TickType_t)1000)
+#define pdMS_TO_TICKS(ms)       ((TickType_t)(((TickType_t)(ms) * configTICK_RATE_HZ) / 1000U))
+#define portYIELD_FROM_ISR(x)   ((void)(x))
+#define taskENTER_CRITICAL()
+#define taskEXIT_CRITICAL()
+#define configASSERT(x)
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef FF_DEFINED
+#define FF_DEFINED
+
+/* 主机编译用的FatFs替身，用标准C文件实现oled.c用到的几个函数 */
+#include "stdint.h"
+#include "stdio.h"
+
+typedef unsigned int UINT;
+typedef uint8_t BYTE;
+typedef char TCHAR;
+typedef uint32_t FSIZE_t;
+
+typedef struct
+{
+    FILE *fp;
+} FIL;
+
+typedef enum
+{
+    FR_OK = 0,
+    FR_DISK_ERR,
+    FR_NO_FILE = 4,
+    FR_INVALID_OBJECT = 9,
+} FRESULT;
+
+#define FA_READ                 0x01
+
+FRESULT f_open(FIL *fp, const TCHAR *path, BYTE mode);
+FRESULT f_close(FIL *fp);
+FRESULT f_lseek(FIL *fp, FSIZE_t ofs);
+FRESULT f_read(FIL *fp, void *buff, UINT btr, UINT *br);
+
+/**
+ * @breif   把FatFs路径映射为主机路径
+ * @param   path:FatFs路径，如"0:/SYSTEM/FONT/GBK12.FON"
+ * @note    只保留文件名，放在环境变量OLED_SIM_FATFS指定的目录，未指定时为/tmp
+ * @retval  主机路径，静态缓冲，下次调用时覆盖
+ */
+const char *oled_sim_fatfs_path(const TCHAR *path);
+
+#endif
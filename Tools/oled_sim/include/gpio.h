@@ -0,0 +1,40 @@
+#ifndef __GPIO_H__
+#define __GPIO_H__
+
+/* 主机编译用的HAL替身，只声明OLED驱动用到的部分 */
+#include "stdint.h"
+#include "stddef.h"
+
+typedef enum
+{
+    HAL_OK = 0,
+    HAL_ERROR,
+    HAL_BUSY,
+    HAL_TIMEOUT
+} HAL_StatusTypeDef;
+
+typedef enum
+{
+    GPIO_PIN_RESET = 0,
+    GPIO_PIN_SET
+} GPIO_PinState;
+
+typedef struct
+{
+    uint32_t odr; /* 输出数据寄存器 */
+} GPIO_TypeDef;
+
+extern GPIO_TypeDef *GPIOA, *GPIOB, *GPIOC;
+
+#define GPIO_PIN_6              ((uint16_t)0x0040)
+#define GPIO_PIN_8              ((uint16_t)0x0100)
+#define GPIO_PIN_14             ((uint16_t)0x4000)
+
+#define __weak                  __attribute__((weak))
+#define __DMB()                 __sync_synchronize()
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+void HAL_Delay(uint32_t Delay);
+uint32_t HAL_GetTick(void);
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef __I2C_H__
+#define __I2C_H__
+
+#include "gpio.h"
+
+typedef struct
+{
+    uint32_t state; /* 未使用 */
+} I2C_HandleTypeDef;
+
+#define I2C_MEMADD_SIZE_8BIT    0x00000001U
+
+extern I2C_HandleTypeDef hi2c1;
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                    uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_I2C_Mem_Write_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                        uint16_t MemAddSize, uint8_t *pData, uint16_t Size);
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c);
+
+#endif
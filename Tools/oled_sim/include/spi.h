@@ -0,0 +1,18 @@
+#ifndef __SPI_H__
+#define __SPI_H__
+
+#include "gpio.h"
+
+typedef struct
+{
+    uint32_t state; /* 未使用 */
+} SPI_HandleTypeDef;
+
+extern SPI_HandleTypeDef hspi2;
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size);
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi);
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi);
+
+#endif
@@ -0,0 +1,382 @@
+#include "oled_emu.h"
+
+#include "string.h"
+#include "stdio.h"
+
+static oled_emu_state_t oled_emu;
+static oled_emu_stats_t oled_emu_stats;
+static uint8_t oled_emu_cmd[8];  /* 正在接收的命令及参数 */
+static uint8_t oled_emu_cmd_len; /* 已接收字节数 */
+static uint8_t oled_emu_cmd_need; /* 参数个数 */
+
+/**
+ * @breif   查询命令的参数个数
+ * @param   cmd:命令字节
+ * @retval  参数个数
+ */
+static uint8_t oled_emu_cmd_args(uint8_t cmd)
+{
+    switch (cmd)
+    {
+    case 0x26: // 水平滚动
+    case 0x27:
+        return 6;
+    case 0x29: // 垂直加水平滚动
+    case 0x2A:
+        return 5;
+    case 0x21: // 列地址
+    case 0x22: // 页地址
+    case 0xA3: // 垂直滚动区域
+        return 2;
+    case 0x20: // 寻址方式
+    case 0x81: // 对比度
+    case 0x8D: // 电荷泵
+    case 0xA8: // 复用率
+    case 0xD3: // 显示偏移
+    case 0xD5: // 时钟分频
+    case 0xD9: // 预充电周期
+    case 0xDA: // COM引脚配置
+    case 0xDB: // VCOMH
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @breif   执行一条完整的命令
+ * @param   cmd:命令及参数
+ * @retval  无
+ */
+static void oled_emu_execute(const uint8_t *cmd)
+{
+    oled_emu_state_t *s = &oled_emu;
+
+    if (cmd[0] <= 0x0F) // 页寻址起始列低4位
+    {
+        s->col_start = (s->col_start & 0xF0) | cmd[0];
+        s->col = s->col_start;
+    }
+    else if (cmd[0] <= 0x1F) // 页寻址起始列高4位
+    {
+        s->col_start = (s->col_start & 0x0F) | ((cmd[0] & 0x0F) << 4);
+        s->col = s->col_start;
+    }
+    else if (cmd[0] >= 0x40 && cmd[0] <= 0x7F)
+    {
+        s->start_line = cmd[0] & 0x3F;
+    }
+    else if (cmd[0] >= 0xB0 && cmd[0] <= 0xB7) // 页寻址当前页
+    {
+        s->page = cmd[0] & 0x07;
+    }
+    else
+    {
+        switch (cmd[0])
+        {
+        case 0x20:
+            s->addr_mode = cmd[1] & 0x03;
+            break;
+        case 0x21: // 设置窗口后写入位置回到起点
+            s->col_start = cmd[1] & 0x7F;
+            s->col_end = cmd[2] & 0x7F;
+            s->col = s->col_start;
+            break;
+        case 0x22:
+            s->page_start = cmd[1] & 0x07;
+            s->page_end = cmd[2] & 0x07;
+            s->page = s->page_start;
+            break;
+        case 0x26:
+        case 0x27:
+            s->scroll_cmd = cmd[0];
+            s->scroll_page_start = cmd[2] & 0x07;
+            s->scroll_interval = cmd[3] & 0x07;
+            s->scroll_page_end = cmd[4] & 0x07;
+            s->scroll_offset = 0;
+            break;
+        case 0x29:
+        case 0x2A:
+            s->scroll_cmd = cmd[0];
+            s->scroll_page_start = cmd[2] & 0x07;
+            s->scroll_interval = cmd[3] & 0x07;
+            s->scroll_page_end = cmd[4] & 0x07;
+            s->scroll_offset = cmd[5] & 0x3F;
+            break;
+        case 0x2E:
+            s->scroll_active = 0;
+            break;
+        case 0x2F:
+            s->scroll_active = 1;
+            break;
+        case 0x81:
+            s->contrast = cmd[1];
+            break;
+        case 0x8D:
+            s->charge_pump = (cmd[1] & 0x04) != 0;
+            break;
+        case 0xA0:
+        case 0xA1:
+            s->seg_remap = cmd[0] & 0x01;
+            break;
+        case 0xA3:
+            s->vscroll_fixed = cmd[1] & 0x3F;
+            s->vscroll_rows = cmd[2] & 0x7F;
+            break;
+        case 0xA4:
+        case 0xA5:
+            s->entire_on = cmd[0] & 0x01;
+            break;
+        case 0xA6:
+        case 0xA7:
+            s->invert = cmd[0] & 0x01;
+            break;
+        case 0xA8:
+            s->mux = (cmd[1] & 0x3F) + 1;
+            break;
+        case 0xAE:
+        case 0xAF:
+            s->display_on = cmd[0] & 0x01;
+            break;
+        case 0xC0:
+        case 0xC8:
+            s->com_remap = (cmd[0] & 0x08) != 0;
+            break;
+        case 0xD3:
+            s->offset = cmd[1] & 0x3F;
+            break;
+        case 0xD5: // 时序相关，不影响画面
+        case 0xD9:
+        case 0xDA:
+        case 0xDB:
+        case 0xE3:
+            break;
+        default:
+            oled_emu_stats.unknown_cmds++;
+            break;
+        }
+    }
+}
+
+/**
+ * @breif   写入一个数据字节并按寻址方式移动写入位置
+ * @param   data:数据
+ * @retval  无
+ */
+static void oled_emu_data(uint8_t data)
+{
+    oled_emu_state_t *s = &oled_emu;
+
+    if (s->scroll_active)
+        oled_emu_stats.scroll_writes++;
+    s->gddram[s->page][s->col] = data;
+
+    if (s->addr_mode == 0) // 水平寻址，列到头换页，页到头回到窗口起点
+    {
+        if (s->col >= s->col_end)
+        {
+            s->col = s->col_start;
+            s->page = (s->page >= s->page_end) ? s->page_start : s->page + 1;
+        }
+        else
+        {
+            s->col++;
+        }
+    }
+    else if (s->addr_mode == 1) // 垂直寻址，页到头换列
+    {
+        if (s->page >= s->page_end)
+        {
+            s->page = s->page_start;
+            s->col = (s->col >= s->col_end) ? s->col_start : s->col + 1;
+        }
+        else
+        {
+            s->page++;
+        }
+    }
+    else // 页寻址，列到头回到起始列，页不变
+    {
+        s->col = (s->col >= OLED_EMU_COLS - 1) ? s->col_start : s->col + 1;
+    }
+}
+
+/**
+ * @breif   复位模拟器，状态与上电复位值一致，显存清零
+ * @param   无
+ * @retval  无
+ */
+void oled_emu_reset(void)
+{
+    memset(&oled_emu, 0, sizeof(oled_emu));
+    memset(&oled_emu_stats, 0, sizeof(oled_emu_stats));
+    oled_emu.addr_mode = 2;
+    oled_emu.col_end = OLED_EMU_COLS - 1;
+    oled_emu.page_end = OLED_EMU_PAGES - 1;
+    oled_emu.mux = OLED_EMU_ROWS;
+    oled_emu.contrast = 0x7F;
+    oled_emu.vscroll_rows = OLED_EMU_ROWS;
+    oled_emu_cmd_len = 0;
+}
+
+/**
+ * @breif   输入一次总线传输
+ * @param   dc:0-命令 1-数据
+ * @param   data:数据
+ * @param   len:长度
+ * @param   overhead:每次传输的附加字节数，I2C控制字节为1，SPI为0
+ * @retval  无
+ */
+void oled_emu_write(uint8_t dc, const uint8_t *data, uint16_t len, uint8_t overhead)
+{
+    uint16_t i;
+
+    oled_emu_stats.bytes += len + overhead;
+    oled_emu_stats.transfers++;
+    if (dc)
+    {
+        oled_emu_cmd_len = 0; // 命令参数不完整时被数据打断，丢弃
+        oled_emu_stats.data_bytes += len;
+        for (i = 0; i < len; i++)
+            oled_emu_data(data[i]);
+        return;
+    }
+
+    oled_emu_stats.cmd_bytes += len;
+    for (i = 0; i < len; i++) // 命令参数可以跨传输
+    {
+        if (oled_emu_cmd_len == 0)
+            oled_emu_cmd_need = oled_emu_cmd_args(data[i]);
+        oled_emu_cmd[oled_emu_cmd_len++] = data[i];
+        if (oled_emu_cmd_len > oled_emu_cmd_need)
+        {
+            oled_emu_execute(oled_emu_cmd);
+            oled_emu_cmd_len = 0;
+        }
+    }
+}
+
+/**
+ * @breif   获取面板状态
+ * @param   无
+ * @retval  面板状态，只读
+ */
+const oled_emu_state_t *oled_emu_state(void)
+{
+    return &oled_emu;
+}
+
+/**
+ * @breif   读取屏幕上看到的像素
+ * @param   x:列 0-127，0为屏幕左边
+ * @param   y:行 0-63，0为屏幕顶部
+ * @retval  0-灭 1-亮
+ */
+uint8_t oled_emu_pixel(uint8_t x, uint8_t y)
+{
+    const oled_emu_state_t *s = &oled_emu;
+    uint8_t col, com, row, pixel;
+
+    if (!s->display_on || x >= OLED_EMU_COLS || y >= OLED_EMU_ROWS)
+        return 0;
+    com = s->com_remap ? y : OLED_EMU_ROWS - 1 - y; // C8从COM0扫描到顶部，C0倒置
+    if (com >= s->mux)
+        return 0;
+    if (s->entire_on)
+        return 1;
+    col = s->seg_remap ? x : OLED_EMU_COLS - 1 - x; // A1为正向，A0左右镜像
+    row = (com + s->offset + s->start_line) % OLED_EMU_ROWS;
+    pixel = (s->gddram[row / 8][col] >> (row % 8)) & 0x01;
+    return pixel ^ s->invert;
+}
+
+/**
+ * @breif   获取自上次oled_emu_frame以来的总线统计
+ * @param   stats:统计
+ * @retval  无
+ */
+void oled_emu_get_stats(oled_emu_stats_t *stats)
+{
+    *stats = oled_emu_stats;
+}
+
+/**
+ * @breif   结束一帧，取出本帧总线统计并清零
+ * @param   stats:本帧统计，NULL不取
+ * @retval  无
+ */
+void oled_emu_frame(oled_emu_stats_t *stats)
+{
+    if (stats != NULL)
+        *stats = oled_emu_stats;
+    memset(&oled_emu_stats, 0, sizeof(oled_emu_stats));
+}
+
+/**
+ * @breif   把屏幕画面保存为PBM(P4)
+ * @param   path:文件路径
+ * @retval  0-成功 1-失败
+ */
+uint8_t oled_emu_save_pbm(const char *path)
+{
+    FILE *f;
+    uint8_t line[OLED_EMU_COLS / 8];
+    uint8_t x, y;
+
+    f = fopen(path, "wb");
+    if (f == NULL)
+        return 1;
+    fprintf(f, "P4\n%d %d\n", OLED_EMU_COLS, OLED_EMU_ROWS);
+    for (y = 0; y < OLED_EMU_ROWS; y++)
+    {
+        memset(line, 0, sizeof(line));
+        for (x = 0; x < OLED_EMU_COLS; x++)
+        {
+            if (oled_emu_pixel(x, y))
+                line[x / 8] |= 0x80 >> (x % 8);
+        }
+        fwrite(line, 1, sizeof(line), f);
+    }
+    fclose(f);
+    return 0;
+}
+
+/**
+ * @breif   与PBM(P4)参考图逐点比较
+ * @param   path:参考图路径，尺寸须为128x64
+ * @retval  不同的像素数，-1表示无法读取
+ */
+int32_t oled_emu_compare_pbm(const char *path)
+{
+    FILE *f;
+    uint8_t line[OLED_EMU_COLS / 8];
+    int width, height, ch;
+    int32_t diff = 0;
+    uint8_t x, y;
+
+    f = fopen(path, "rb");
+    if (f == NULL)
+        return -1;
+    if (fscanf(f, "P4 %d %d", &width, &height) != 2 || width != OLED_EMU_COLS || height != OLED_EMU_ROWS)
+    {
+        fclose(f);
+        return -1;
+    }
+    ch = fgetc(f); // 尺寸后的单个空白字符
+    (void)ch;
+    for (y = 0; y < OLED_EMU_ROWS; y++)
+    {
+        if (fread(line, 1, sizeof(line), f) != sizeof(line))
+        {
+            fclose(f);
+            return -1;
+        }
+        for (x = 0; x < OLED_EMU_COLS; x++)
+        {
+            if (((line[x / 8] >> (7 - x % 8)) & 0x01) != oled_emu_pixel(x, y))
+                diff++;
+        }
+    }
+    fclose(f);
+    return diff;
+}
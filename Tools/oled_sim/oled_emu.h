@@ -0,0 +1,113 @@
+#ifndef __OLED_EMU_H_
+#define __OLED_EMU_H_
+
+#include "stdint.h"
+
+#define OLED_EMU_PAGES          8   /* GDDRAM页数 */
+#define OLED_EMU_COLS           128 /* GDDRAM列数 */
+#define OLED_EMU_ROWS           64  /* GDDRAM行数 */
+
+/* SSD1306面板状态，按命令流逐字节解析得到 */
+typedef struct
+{
+    uint8_t gddram[OLED_EMU_PAGES][OLED_EMU_COLS]; /* 显示RAM */
+    uint8_t addr_mode;      /* 寻址方式 0-水平 1-垂直 2-页 */
+    uint8_t col_start;      /* 列地址窗口(0x21)，页寻址时为0x00/0x10设置的起始列 */
+    uint8_t col_end;
+    uint8_t page_start;     /* 页地址窗口(0x22) */
+    uint8_t page_end;
+    uint8_t col;            /* 当前写入列 */
+    uint8_t page;           /* 当前写入页 */
+    uint8_t start_line;     /* 显示起始行(0x40-0x7F) */
+    uint8_t offset;         /* 显示偏移(0xD3) */
+    uint8_t mux;            /* 复用率(0xA8)+1，即有效行数 */
+    uint8_t contrast;       /* 对比度(0x81) */
+    uint8_t invert;         /* 1-反色显示(0xA7) */
+    uint8_t entire_on;      /* 1-全亮(0xA5) */
+    uint8_t display_on;     /* 1-开显示(0xAF) */
+    uint8_t charge_pump;    /* 1-电荷泵开启(0x8D 0x14) */
+    uint8_t seg_remap;      /* 1-列重映射(0xA1) */
+    uint8_t com_remap;      /* 1-行扫描反向(0xC8) */
+    uint8_t scroll_active;  /* 1-硬件滚动进行中(0x2F) */
+    uint8_t scroll_cmd;     /* 最近一次滚动设置命令 0x26/0x27/0x29/0x2A，0为未设置 */
+    uint8_t scroll_page_start; /* 滚动起始页 */
+    uint8_t scroll_page_end;   /* 滚动结束页 */
+    uint8_t scroll_interval;   /* 滚动帧间隔 0-7 */
+    uint8_t scroll_offset;     /* 对角滚动每步垂直偏移行数 */
+    uint8_t vscroll_fixed;  /* 垂直滚动区域(0xA3)顶部固定行数 */
+    uint8_t vscroll_rows;   /* 垂直滚动区域行数 */
+} oled_emu_state_t;
+
+/* 总线统计，字节数含每次传输的控制字节，与oled_get_tx_bytes口径一致 */
+typedef struct
+{
+    uint32_t bytes;         /* 总线字节数 */
+    uint32_t transfers;     /* 传输次数 */
+    uint32_t cmd_bytes;     /* 命令字节数(不含控制字节) */
+    uint32_t data_bytes;    /* 数据字节数(不含控制字节) */
+    uint32_t scroll_writes; /* 硬件滚动期间写入的数据字节数，手册规定此时不应改写显存 */
+    uint32_t unknown_cmds;  /* 无法识别的命令数 */
+} oled_emu_stats_t;
+
+/**
+ * @breif   复位模拟器，状态与上电复位值一致，显存清零
+ * @param   无
+ * @retval  无
+ */
+void oled_emu_reset(void);
+
+/**
+ * @breif   输入一次总线传输
+ * @param   dc:0-命令 1-数据
+ * @param   data:数据
+ * @param   len:长度
+ * @param   overhead:每次传输的附加字节数，I2C控制字节为1，SPI为0
+ * @retval  无
+ */
+void oled_emu_write(uint8_t dc, const uint8_t *data, uint16_t len, uint8_t overhead);
+
+/**
+ * @breif   获取面板状态
+ * @param   无
+ * @retval  面板状态，只读
+ */
+const oled_emu_state_t *oled_emu_state(void);
+
+/**
+ * @breif   读取屏幕上看到的像素，已计入起始行、偏移、重映射、反色、全亮与开关显示
+ * @param   x:列 0-127，0为屏幕左边(A1/C8为正向，与驱动初始化一致)
+ * @param   y:行 0-63，0为屏幕顶部
+ * @retval  0-灭 1-亮
+ */
+uint8_t oled_emu_pixel(uint8_t x, uint8_t y);
+
+/**
+ * @breif   获取自上次oled_emu_frame以来的总线统计
+ * @param   stats:统计
+ * @retval  无
+ */
+void oled_emu_get_stats(oled_emu_stats_t *stats);
+
+/**
+ * @breif   结束一帧，取出本帧总线统计并清零，开始下一帧计数
+ * @param   stats:本帧统计，NULL不取
+ * @retval  无
+ */
+void oled_emu_frame(oled_emu_stats_t *stats);
+
+/**
+ * @breif   把屏幕画面保存为PBM(P4)
+ * @param   path:文件路径
+ * @note    亮点记为1(黑)，可用Tools/oled_imgc.py转回页格式数组
+ * @retval  0-成功 1-失败
+ */
+uint8_t oled_emu_save_pbm(const char *path);
+
+/**
+ * @breif   与PBM参考图逐点比较
+ * @param   path:参考图路径，尺寸须为128x64
+ * @retval  不同的像素数，-1表示无法读取
+ */
+int32_t oled_emu_compare_pbm(const char *path);
+
+#endif
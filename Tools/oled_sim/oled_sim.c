@@ -0,0 +1,605 @@
+/*
+ * OLED驱动主机模拟
+ *
+ * 在PC上编译HardWare下的驱动，总线写入交给SSD1306命令流模拟器(oled_emu.c)，
+ * 逐个绘制测试画面，保存为PBM并统计每帧的总线字节数与传输次数，
+ * 指定参考目录时逐点比较，有差异则返回1，可用于改动驱动后的回归检查与吞吐对比。
+ *
+ * 编译(在仓库根目录):
+ *     gcc -std=gnu99 -O2 -ITools/oled_sim/include -ITools/oled_sim -IHardWare \
+ *         Tools/oled_sim/oled_sim.c Tools/oled_sim/oled_emu.c Tools/oled_sim/hal_stub.c \
+ *         HardWare/oled.c HardWare/oled_font.c HardWare/oled_format.c HardWare/oled_chart.c \
+ *         HardWare/oled_console.c HardWare/oled_field.c HardWare/oled_tile.c HardWare/oled_canvas.c \
+ *         HardWare/oled_bench.c -o oled_sim
+ *
+ * 用法:
+ *     ./oled_sim -r Tools/oled_sim/golden  # 回归检查：与仓库中的参考图逐点比较，有差异返回1
+ *     ./oled_sim -o out                    # 生成out/<画面>.pbm作为参考图
+ *     ./oled_sim -r out                    # 与参考图比较
+ *     ./oled_sim -o new -r out text        # 只跑text画面，保存并比较
+ *     ./oled_sim -f                        # 格式化检查：oled_vformat与vsnprintf逐条比较，不一致返回1
+ *     ./oled_sim -b json > bench.json      # 运行绘图基准测试(oled_bench.c，需OLED_BENCH_EN为1)，输出JSON或CSV
+ *
+ * Tools/oled_sim/golden是当前驱动的输出，改动驱动后先跑回归检查；画面有意改变时用
+ * ./oled_sim -o Tools/oled_sim/golden重新生成并一同提交。画面与配置无关，各种开关组合都应与之一致。
+ * 配置沿用HardWare/oled.h的开关，可分别在单缓冲/双缓冲、同步/异步下运行对比。
+ * OLED_FONT_GBK_EN为1时多一个gbk画面：FatFs由include/Middlewares/FATFS/ff.h的替身转为读写主机文件，
+ * 字库文件生成在环境变量OLED_SIM_FATFS指定的目录(默认/tmp)，并检查重画时字模缓存全部命中。
+ */
+
+#include "oled.h"
+#include "oled_chart.h"
+#include "oled_console.h"
+#include "oled_field.h"
+#include "oled_tile.h"
+#include "oled_canvas.h"
+#include "oled_bench.h"
+#include "oled_emu.h"
+
+#include "stdio.h"
+#include "string.h"
+
+typedef struct
+{
+    const char *name;         /* 画面名，也是PBM文件名 */
+    uint16_t (*draw)(void);   /* 绘制函数，自行调用oled_sim_present，返回帧数 */
+} oled_sim_scene_t;
+
+static oled_emu_stats_t oled_sim_total; /* 当前画面的总线统计累计 */
+static oled_emu_stats_t oled_sim_peak;  /* 当前画面单帧最大值 */
+static const char *oled_sim_error;      /* 当前画面自检失败的原因，NULL为通过 */
+
+/**
+ * @breif   把一帧送到屏幕并累计本帧总线统计
+ * @param   无
+ * @retval  无
+ */
+static void oled_sim_present(void)
+{
+    oled_emu_stats_t frame;
+
+#if OLED_DOUBLE_BUFFER_EN
+    oled_swap_buffers(); // 主机上没有显示任务，交换后直接刷新前台缓冲
+#endif
+    oled_flush();
+    oled_emu_frame(&frame);
+    oled_sim_total.bytes += frame.bytes;
+    oled_sim_total.transfers += frame.transfers;
+    oled_sim_total.cmd_bytes += frame.cmd_bytes;
+    oled_sim_total.data_bytes += frame.data_bytes;
+    oled_sim_total.scroll_writes += frame.scroll_writes;
+    oled_sim_total.unknown_cmds += frame.unknown_cmds;
+    if (frame.bytes > oled_sim_peak.bytes)
+        oled_sim_peak = frame;
+}
+
+static uint16_t oled_sim_text(void)
+{
+    oled_show_string(0, 0, (uint8_t *)"6x8 ABCxyz 0123", OLED_FONT_6X8);
+    oled_show_string(0, 10, (uint8_t *)"7x12 Hello", OLED_FONT_7X12);
+    oled_show_string(0, 24, (uint8_t *)"8x16 OLED!", OLED_FONT_8X16);
+    oled_printf(0, 44, OLED_FONT_6X8, "%-5d|%05.2f|%X", -42, 3.14159, 0xBEEF);
+    oled_printf(0, 54, OLED_FONT_6X8, "%8s|%c|%+d", "right", '#', 7);
+    oled_sim_present();
+    return 1;
+}
+
+static uint16_t oled_sim_shapes(void)
+{
+    static const oled_point_t star[5] = {{100, 2}, {112, 40}, {80, 16}, {120, 16}, {88, 40}};
+
+    oled_draw_rectangle(0, 0, 40, 24, 0);
+    oled_draw_rectangle(4, 4, 32, 16, 1);
+    oled_draw_line(0, 63, 60, 28);
+    oled_draw_circle(20, 44, 14, 0);
+    oled_draw_circle(20, 44, 6, 1);
+    oled_draw_ellipse(60, 44, 18, 10, 0);
+    oled_draw_arc(60, 20, 16, 0, 180);
+    oled_fill_polygon(star, 5);
+    oled_draw_hline(80, 50, 48);
+    oled_draw_vline(127, 0, 64);
+    oled_sim_present();
+    return 1;
+}
+
+static uint16_t oled_sim_rop(void)
+{
+    oled_draw_rectangle(8, 8, 64, 40, 1);
+    oled_set_rop(OLED_ROP_XOR);
+    oled_draw_circle(40, 28, 24, 1);
+    oled_set_clip(64, 0, 64, 64);
+    oled_draw_rectangle(56, 16, 64, 32, 1);
+    oled_reset_clip();
+    oled_set_rop(OLED_ROP_COPY);
+    oled_reverse_area(96, 40, 32, 24);
+    oled_sim_present();
+    return 1;
+}
+
+static uint16_t oled_sim_scroll(void)
+{
+    uint8_t line;
+
+    for (line = 0; line < 8; line++)
+        oled_printf(0, line * 8, OLED_FONT_6X8, "line %u", line);
+    oled_sim_present();
+    oled_scroll_vertical(3); // 起始行移动，只补发底部3页
+    oled_printf(0, 56, OLED_FONT_6X8, "new bottom");
+    oled_sim_present();
+    oled_scroll_vertical(-1);
+    oled_printf(0, 0, OLED_FONT_6X8, "new top");
+    oled_sim_present();
+    return 3;
+}
+
+static uint16_t oled_sim_chart(void)
+{
+    oled_chart_t chart;
+    uint16_t i;
+    int16_t value;
+
+    oled_draw_rectangle(0, 0, 128, 64, 0);
+    oled_chart_init(&chart, 1, 8, 126, 48, -100, 100);
+    oled_sim_present();
+    for (i = 0; i < 200; i++) // 三角波，超过一屏后覆盖最旧的列
+    {
+        value = (int16_t)(i % 50) * 8 - 200;
+        oled_chart_add(&chart, (i / 50) % 2 ? -value - 100 : value + 100);
+        oled_sim_present();
+    }
+    return 201;
+}
+
+static uint16_t oled_sim_console(void)
+{
+    uint8_t i;
+
+    oled_console_init(OLED_FONT_6X8);
+    for (i = 0; i < 12; i++)
+    {
+        oled_console_printf("msg %u: value=%d\n", i, i * 17 - 50);
+        oled_sim_present();
+    }
+    oled_console_write("abc\bd");
+    oled_sim_present();
+    return 13;
+}
+
+static uint16_t oled_sim_field(void)
+{
+    oled_field_t count, temp;
+    int32_t i;
+
+    oled_show_string(0, 0, (uint8_t *)"count", OLED_FONT_6X8);
+    oled_show_string(0, 24, (uint8_t *)"temp", OLED_FONT_6X8);
+    oled_field_init(&count, 48, 0, OLED_FONT_8X16, 8, 0, 0);
+    oled_field_init(&temp, 48, 24, OLED_FONT_8X16, 6, 1, 0);
+    for (i = 0; i < 100; i++)
+    {
+        oled_field_set(&count, i * 13);
+        oled_field_set(&temp, 235 - i);
+        oled_sim_present();
+    }
+    return 100;
+}
+
+static uint16_t oled_sim_tile(void)
+{
+    static const uint8_t tiles[] = {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0 空白
+        0xEE, 0xEE, 0xEE, 0x00, 0xBB, 0xBB, 0xBB, 0x00, // 1 砖墙
+        0x00, 0x00, 0x24, 0x00, 0x00, 0x42, 0x00, 0x00, // 2 星点
+        0xF0, 0xF8, 0xF0, 0xE0, 0xF0, 0xF8, 0xFC, 0xF8, // 3 地面
+    };
+    static const uint8_t ball[] = {0x3C, 0x42, 0x99, 0xA5, 0xA5, 0x99, 0x42, 0x3C};
+    static const uint8_t ball_mask[] = {0x3C, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x3C};
+    static uint8_t map[8][24];
+    uint8_t row, col, i;
+
+    for (row = 0; row < 8; row++)
+        for (col = 0; col < 24; col++)
+            map[row][col] = row == 7 ? 3 : (row == 6 && col % 6 < 2) ? 1 : (row + col) % 5 == 0 ? 2 : 0;
+    oled_tile_init(tiles, &map[0][0], 24, 8);
+    for (i = 0; i < 8; i++) // 滚动，整屏重新合成
+    {
+        oled_tile_scroll(i * 3, 0);
+        oled_tile_render();
+        oled_sim_present();
+    }
+    for (i = 0; i < 16; i++) // 只有精灵移动，只合成它经过的格
+    {
+        oled_sprite_show(0, ball, ball_mask, 8, 8, 20 + i * 5, 40 - i % 4 * 3);
+        oled_tile_render();
+        oled_sim_present();
+    }
+    oled_tile_set(10, 6, 1); // 改一个图块，只发送一格
+    oled_tile_render();
+    oled_sim_present();
+    return 25;
+}
+
+static uint16_t oled_sim_canvas(void)
+{
+    static uint8_t buffer[32 * OLED_LIST];
+    static uint8_t packed[2048];
+    oled_canvas_t list;
+    uint8_t i;
+
+    oled_canvas_init(&list, buffer, 32); // 128x256，16项的列表只绘制一次
+    oled_canvas_begin(&list);
+    for (i = 0; i < 16; i++)
+    {
+        oled_printf(4, i * 16, OLED_FONT_8X16, "Item %u", i);
+        oled_draw_hline(0, i * 16 + 15, OLED_LIST);
+    }
+    oled_canvas_end();
+    oled_canvas_compress(&list, packed, sizeof(packed));
+
+    for (i = 0; i < 8; i++) // 按页平移，只补发新露出的页
+    {
+        oled_canvas_view(&list, i * 16);
+        oled_sim_present();
+    }
+    for (i = 0; i < 8; i++) // 逐行平移，整屏复制
+    {
+        oled_canvas_view(&list, 112 + i * 3);
+        oled_sim_present();
+    }
+    return 16;
+}
+
+static uint16_t oled_sim_setting(void)
+{
+    oled_show_string(0, 0, (uint8_t *)"invert+contrast", OLED_FONT_6X8);
+    oled_draw_rectangle(0, 16, 64, 48, 1);
+    oled_sim_present();
+    oled_show_setting(1, 0x20); // 对比度在画面上看不出，只记录在面板状态
+    oled_show_setting(4, 1);
+    oled_sim_present(); // 无脏区，本帧只有两条设置命令
+    return 2;
+}
+
+#if OLED_FONT_GBK_EN
+/**
+ * @breif   生成合成的GBK字库文件，只写入画面用到的字，其余为空洞
+ * @param   font_size:字体大小 OLED_FONT_7X12/OLED_FONT_8X16
+ * @param   path:FatFs路径
+ * @param   codes:要写入的GBK编码，0结尾
+ * @note    字模为外框加编码各位，格式同真实字库：列优先，每列上下两字节，高位在上
+ * @retval  0-成功 1-无法写入
+ */
+static uint8_t oled_sim_make_font(uint8_t font_size, const char *path, const uint16_t *codes)
+{
+    uint8_t width = (font_size == OLED_FONT_7X12) ? 12 : 16;
+    uint8_t bottom = (font_size == OLED_FONT_7X12) ? 0x10 : 0x01; /* 下半字节中最后一行的位 */
+    uint8_t edge = (font_size == OLED_FONT_7X12) ? 0xF0 : 0xFF;   /* 下半字节中有效的行 */
+    uint8_t buf[32];
+    uint8_t i;
+    FILE *fp = fopen(oled_sim_fatfs_path(path), "wb");
+
+    if (fp == NULL)
+        return 1;
+    for (; *codes != 0; codes++)
+    {
+        for (i = 0; i < width; i++)
+        {
+            if (i == 0 || i == width - 1)
+            {
+                buf[i * 2] = 0xFF;
+                buf[i * 2 + 1] = edge;
+            }
+            else
+            {
+                buf[i * 2] = 0x80 | ((*codes >> (i - 1)) & 1 ? 0x3C : 0x00);
+                buf[i * 2 + 1] = bottom;
+            }
+        }
+        fseek(fp, (((*codes >> 8) - 0x81) * 190L + ((*codes & 0xFF) - ((*codes & 0xFF) < 0x7F ? 0x40 : 0x41))) * width * 2,
+              SEEK_SET);
+        fwrite(buf, 1, width * 2, fp);
+    }
+    fclose(fp);
+    return 0;
+}
+
+static uint16_t oled_sim_gbk(void)
+{
+    static const uint16_t codes[] = {0xCEC2, 0xB6C8, 0xCAAA, 0xB5E7, 0xD1B9, 0};
+    /* 温度 湿度 电压，末尾0x8041不是GBK编码，不读文件也不计入统计 */
+    static const uint8_t label[] = "\xCE\xC2\xB6\xC8 \xCA\xAA\xB6\xC8 \xB5\xE7\xD1\xB9\x80\x41";
+    uint32_t hit, miss;
+    uint8_t pass;
+
+    if (oled_sim_make_font(OLED_FONT_7X12, GBK12_FONT_PATH, codes) || oled_sim_make_font(OLED_FONT_8X16, GBK16_FONT_PATH, codes))
+    {
+        oled_sim_error = "cannot write font files";
+        return 1;
+    }
+    oled_font_close();
+    for (pass = 0; pass < 2; pass++) // 第二遍重画相同的字，应全部命中缓存
+    {
+        oled_clear_glyph_stats();
+        oled_clear_all();
+        oled_show_font_string(0, 0, label, OLED_FONT_7X12);
+        oled_show_font_string(0, 16, label, OLED_FONT_8X16);
+        oled_sim_present();
+        oled_get_glyph_stats(&hit, &miss);
+        if (pass == 0 && (miss != 10 || hit != 2)) // 每种字号5个不同的字，"度"第二次出现时命中
+            oled_sim_error = "first pass should read each glyph once";
+        if (pass == 1 && (miss != 0 || hit != 12))
+            oled_sim_error = "second pass missed the glyph cache";
+    }
+    oled_font_close();
+    return 2;
+}
+#endif
+
+static const oled_sim_scene_t oled_sim_scenes[] = {
+    {"text", oled_sim_text},
+    {"shapes", oled_sim_shapes},
+    {"rop", oled_sim_rop},
+    {"scroll", oled_sim_scroll},
+    {"chart", oled_sim_chart},
+    {"console", oled_sim_console},
+    {"field", oled_sim_field},
+    {"tile", oled_sim_tile},
+    {"canvas", oled_sim_canvas},
+    {"setting", oled_sim_setting},
+#if OLED_FONT_GBK_EN
+    {"gbk", oled_sim_gbk},
+#endif
+};
+
+/**
+ * @breif   运行一个画面，保存并比较
+ * @param   scene:画面
+ * @param   out_dir:保存目录，NULL不保存
+ * @param   ref_dir:参考目录，NULL不比较
+ * @retval  0-通过 1-与参考图不同、自检失败或无法读写
+ */
+static uint8_t oled_sim_run(const oled_sim_scene_t *scene, const char *out_dir, const char *ref_dir)
+{
+    char path[256];
+    uint16_t frames;
+    int32_t diff = 0;
+    uint8_t result = 0;
+
+    oled_emu_reset(); // 每个画面从上电状态开始，互不影响
+    oled_init();
+    oled_emu_frame(NULL);
+    memset(&oled_sim_total, 0, sizeof(oled_sim_total));
+    memset(&oled_sim_peak, 0, sizeof(oled_sim_peak));
+    oled_sim_error = NULL;
+
+    frames = scene->draw();
+
+    if (out_dir != NULL)
+    {
+        snprintf(path, sizeof(path), "%s/%s.pbm", out_dir, scene->name);
+        if (oled_emu_save_pbm(path))
+        {
+            printf("%s: cannot write %s\n", scene->name, path);
+            result = 1;
+        }
+    }
+    if (ref_dir != NULL)
+    {
+        snprintf(path, sizeof(path), "%s/%s.pbm", ref_dir, scene->name);
+        diff = oled_emu_compare_pbm(path);
+        if (diff != 0)
+            result = 1;
+    }
+
+    printf("%-8s %5u %8lu %6lu %8lu %8lu %7lu %7lu %5u %5u  %s", scene->name, frames,
+           (unsigned long)oled_sim_total.bytes, (unsigned long)oled_sim_total.transfers,
+           (unsigned long)oled_sim_total.bytes / frames, (unsigned long)oled_sim_peak.bytes,
+           (unsigned long)oled_sim_total.cmd_bytes, (unsigned long)oled_sim_total.data_bytes,
+           oled_emu_state()->start_line, oled_emu_state()->contrast,
+           ref_dir == NULL ? "-" : (diff == 0 ? "ok" : "FAIL"));
+    if (diff > 0)
+        printf(" (%ld pixels)", (long)diff);
+    else if (diff < 0)
+        printf(" (no reference)");
+    if (oled_sim_total.scroll_writes != 0 || oled_sim_total.unknown_cmds != 0)
+        printf(" [scroll_writes=%lu unknown_cmds=%lu]", (unsigned long)oled_sim_total.scroll_writes,
+               (unsigned long)oled_sim_total.unknown_cmds);
+    if (oled_sim_error != NULL)
+    {
+        printf(" [error: %s]", oled_sim_error);
+        result = 1;
+    }
+    printf("\n");
+    return result;
+}
+
+#if OLED_BENCH_EN
+/**
+ * @breif   基准测试结果输出到标准输出
+ * @param   arg:未使用
+ * @param   ch:字符
+ * @retval  无
+ */
+static void oled_sim_putc(void *arg, char ch)
+{
+    (void)arg;
+    putchar(ch);
+}
+#endif
+
+typedef struct
+{
+    const char *fmt; /* 格式串，只含一个转换 */
+    char type;       /* 参数类型 i-int u-unsigned d-double s-字符串 c-字符 w-带*宽度的int L-long long */
+    long long i;     /* 整数参数 */
+    double d;        /* 浮点参数 */
+    const char *s;   /* 字符串参数 */
+} oled_sim_format_t;
+
+/* oled_vformat与vsnprintf应逐字符一致的格式，C库的差异见oled_format.h */
+static const oled_sim_format_t oled_sim_formats[] = {
+    {"[%d]", 'i', 0},           {"[%d]", 'i', -2147483647 - 1}, {"[%5d]", 'i', 42},
+    {"[%-5d|]", 'i', -42},      {"[%05d]", 'i', -42},           {"[%+d]", 'i', 7},
+    {"[% d]", 'i', 7},          {"[%.3d]", 'i', 5},             {"[%.0d]", 'i', 0},
+    {"[%*d]", 'w', 123},        {"[%i]", 'i', -1},              {"[%u]", 'u', 4294967295U},
+    {"[%x]", 'u', 0xBEEF},      {"[%X]", 'u', 0xBEEF},          {"[%#x]", 'u', 0xBEEF},
+    {"[%#X]", 'u', 0xBEEF},     {"[%#x]", 'u', 0},              {"[%#08x]", 'u', 0x1F},
+    {"[%#10.4x]", 'u', 0x1F},   {"[%o]", 'u', 8},               {"[%#o]", 'u', 8},
+    {"[%#o]", 'u', 0},          {"[%#.3o]", 'u', 8},            {"[%lu]", 'u', 123456},
+    {"[%hd]", 'i', -12},        {"[%lld]", 'L', -5},            {"[%c]", 'c', 'A'},
+    {"[%3c]", 'c', 'B'},        {"[%s]", 's', 0, 0, "text"},    {"[%8s]", 's', 0, 0, "text"},
+    {"[%-8s|]", 's', 0, 0, "text"}, {"[%.2s]", 's', 0, 0, "text"}, {"[100%%]", 'i', 0},
+    {"[%f]", 'd', 0, 3.14159},  {"[%.1f]", 'd', 0, 1.25},       {"[%.1f]", 'd', 0, 1.35},
+    {"[%.2f]", 'd', 0, 0.125},  {"[%.2f]", 'd', 0, 2.675},      {"[%.0f]", 'd', 0, 0.5},
+    {"[%.0f]", 'd', 0, 1.5},    {"[%.0f]", 'd', 0, 2.5},        {"[%.0f]", 'd', 0, 3.5},
+    {"[%f]", 'd', 0, -0.0},     {"[%.0f]", 'd', 0, -0.4},       {"[%+f]", 'd', 0, 0.0},
+    {"[% .2f]", 'd', 0, 1.0},   {"[%10.2f]", 'd', 0, -3.14159}, {"[%-10.2f|]", 'd', 0, 3.14159},
+    {"[%010.3f]", 'd', 0, -2.5}, {"[%08.2f]", 'd', 0, 9.999},   {"[%#.0f]", 'd', 0, 7.0},
+    {"[%.9f]", 'd', 0, 0.9999999999}, {"[%5.1f]", 'd', 0, 9.96}, {"[%f]", 'd', 0, 1e-300},
+    {"[%.9f]", 'd', 0, 5e-10},  {"[%.3f]", 'd', 0, 4294967294.9996}, {"[%.6f]", 'd', 0, 0.000000500001},
+};
+
+/**
+ * @breif   oled_vformat输出到字符串
+ * @param   arg:写入位置，char **
+ * @param   ch:字符
+ * @retval  无
+ */
+static void oled_sim_format_putc(void *arg, char ch)
+{
+    char **pos = arg;
+    *(*pos)++ = ch;
+}
+
+/**
+ * @breif   同一组参数分别交给oled_vformat与vsnprintf
+ * @param   got:oled_vformat的结果
+ * @param   expect:vsnprintf的结果
+ * @param   size:缓冲区大小
+ * @param   fmt:格式串
+ * @retval  无
+ */
+static void oled_sim_format_pair(char *got, char *expect, size_t size, const char *fmt, ...)
+{
+    va_list args;
+    char *pos = got;
+
+    va_start(args, fmt);
+    oled_vformat(oled_sim_format_putc, &pos, fmt, args);
+    va_end(args);
+    *pos = '\0';
+    va_start(args, fmt);
+    vsnprintf(expect, size, fmt, args);
+    va_end(args);
+}
+
+/**
+ * @breif   比较oled_vformat与C库vsnprintf的输出
+ * @param   无
+ * @retval  0-全部一致 1-有差异
+ */
+static int oled_sim_format_check(void)
+{
+    char got[64], expect[64];
+    const oled_sim_format_t *f;
+    int failed = 0;
+    size_t i;
+
+    for (i = 0; i < sizeof(oled_sim_formats) / sizeof(oled_sim_formats[0]); i++)
+    {
+        f = &oled_sim_formats[i];
+        switch (f->type)
+        {
+        case 'i':
+        case 'c':
+            oled_sim_format_pair(got, expect, sizeof(expect), f->fmt, (int)f->i);
+            break;
+        case 'u':
+            oled_sim_format_pair(got, expect, sizeof(expect), f->fmt, (unsigned int)f->i);
+            break;
+        case 'w':
+            oled_sim_format_pair(got, expect, sizeof(expect), f->fmt, 8, (int)f->i);
+            break;
+        case 'L':
+            oled_sim_format_pair(got, expect, sizeof(expect), f->fmt, f->i);
+            break;
+        case 'd':
+            oled_sim_format_pair(got, expect, sizeof(expect), f->fmt, f->d);
+            break;
+        default:
+            oled_sim_format_pair(got, expect, sizeof(expect), f->fmt, f->s);
+            break;
+        }
+        if (strcmp(got, expect) != 0)
+        {
+            printf("%-12s got %s expected %s\n", f->fmt, got, expect);
+            failed = 1;
+        }
+    }
+    printf("format   %u cases %s\n", (unsigned)i, failed ? "FAIL" : "ok");
+    return failed;
+}
+
+int main(int argc, char **argv)
+{
+    const char *out_dir = NULL, *ref_dir = NULL;
+    uint8_t selected[sizeof(oled_sim_scenes) / sizeof(oled_sim_scenes[0])];
+    uint8_t any = 0, failed = 0;
+    uint8_t i;
+    int arg;
+
+    memset(selected, 0, sizeof(selected));
+    for (arg = 1; arg < argc; arg++)
+    {
+        if (strcmp(argv[arg], "-o") == 0 && arg + 1 < argc)
+        {
+            out_dir = argv[++arg];
+        }
+        else if (strcmp(argv[arg], "-r") == 0 && arg + 1 < argc)
+        {
+            ref_dir = argv[++arg];
+        }
+        else if (strcmp(argv[arg], "-f") == 0)
+        {
+            return oled_sim_format_check();
+        }
+        else if (strcmp(argv[arg], "-b") == 0 && arg + 1 < argc)
+        {
+            arg++;
+#if OLED_BENCH_EN
+            oled_emu_reset();
+            oled_init();
+            oled_bench_run(strcmp(argv[arg], "json") == 0 ? OLED_BENCH_JSON : OLED_BENCH_CSV, oled_sim_putc, NULL);
+            return 0;
+#else
+            printf("benchmark not compiled, set OLED_BENCH_EN to 1 in HardWare/oled_bench.h\n");
+            return 2;
+#endif
+        }
+        else
+        {
+            for (i = 0; i < sizeof(selected); i++)
+            {
+                if (strcmp(argv[arg], oled_sim_scenes[i].name) == 0)
+                    break;
+            }
+            if (i == sizeof(selected))
+            {
+                printf("usage: %s [-o out_dir] [-r ref_dir] [scene...] | -f | -b csv|json\nscenes:", argv[0]);
+                for (i = 0; i < sizeof(selected); i++)
+                    printf(" %s", oled_sim_scenes[i].name);
+                printf("\n");
+                return 2;
+            }
+            selected[i] = 1;
+            any = 1;
+        }
+    }
+
+    printf("scene    frames    bytes  xfers  B/frame max/frame     cmd    data start contr  ref\n");
+    for (i = 0; i < sizeof(selected); i++)
+    {
+        if (!any || selected[i])
+            failed |= oled_sim_run(&oled_sim_scenes[i], out_dir, ref_dir);
+    }
+    return failed;
+}